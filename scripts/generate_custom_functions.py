@@ -66,8 +66,52 @@ def parse_yaml(file_path):
 	functions = parse_function_data(functions,yaml_data,'window_functions')
 	return urn, functions
 
+# The declared (YAML) type names that correspond to a protobuf `Type.kind`
+# oneof case, keyed by the kind field name. Declared names are normalized to
+# these before lookup (see normalize_type_name), and each one is emitted as its
+# `substrait::Type::k<Kind>` enumerator, so the C++ side can match a signature
+# against `substrait::Type::kind_case()` without any string handling.
+PROTO_KINDS = [
+	"bool", "i8", "i16", "i32", "i64", "fp32", "fp64", "string", "binary",
+	"timestamp", "date", "time", "interval_year", "interval_day",
+	"interval_compound", "timestamp_tz", "uuid", "fixed_char", "varchar",
+	"fixed_binary", "decimal", "precision_time", "precision_timestamp",
+	"precision_timestamp_tz", "struct", "list", "map",
+]
+
+# Wildcard argument types, matched at lookup against any of the kinds in
+# IsWildcardKind() (custom_extensions.cpp) instead of being expanded here.
+WILDCARD_TYPES = {"any", "any1"}
+
+# Must match SUBSTRAIT_MAX_SIGNATURE_ARGS in custom_extensions.hpp.
+MAX_SIGNATURE_ARGS = 8
+
+
+def normalize_type_name(type_name):
+	# Normalize the declared type names to the protobuf Type.kind field names,
+	# so overloads resolve regardless of the spelling difference (e.g.
+	# fixedchar -> fixed_char). functions_arithmetic_decimal spells the
+	# aggregate sum/avg argument `DECIMAL` (uppercase) while its scalar
+	# functions and every other extension use lowercase `decimal`.
+	type_name = type_name.replace("boolean", "bool")
+	type_name = type_name.replace("fixedchar", "fixed_char")
+	type_name = type_name.replace("fixedbinary", "fixed_binary")
+	return type_name.replace("DECIMAL", "decimal")
+
+
+def kind_expression(type_name):
+	if type_name in WILDCARD_TYPES:
+		return "ANY"
+	if type_name in PROTO_KINDS:
+		return "Type::k" + "".join(part.capitalize() for part in type_name.split("_"))
+	# User-defined types (u!geometry), function arguments (func<...>) and other
+	# generic parameters can never be produced by the DuckDB producer
+	return "UNKNOWN"
+
+
 def get_custom_functions(custom_extension_folder):
-	inner_code = ""
+	"""Return the declared signatures as (name, [type names], urn) tuples, in declaration order."""
+	signatures = []
 	type_set = set()
 	custom_function_paths = next(walk(custom_extension_folder), (None, None, []))[2]
 	for custom_function_path in custom_function_paths:
@@ -85,32 +129,74 @@ def get_custom_functions(custom_extension_folder):
 					type_value = regex.sub(r'<[^>]*>', '', args["value"])
 					if type_value:
 						type_set.add(type_value)
-						types.append(f"\"{type_value}\"")
-				type_str = "{" + ", ".join(types) + "}"
-				function_name = function["name"]
-				inner_code += f"\tInsertCustomFunction(\"{function_name}\", {type_str}, \"{urn}\");\n"
+						types.append(type_value)
+				signatures.append((function["name"], types, urn))
 	print(type_set)
-	return inner_code
+	return signatures
+
 
-def write_custom_extension_file(custom_functions):
+def generate_signature_table(signatures):
+	"""Render the signatures as a table sorted by function name.
+
+	The sort is stable, so overloads of one function keep their declaration
+	order: when several of them match the same arguments the last declared one
+	wins at lookup, as it did when every signature was inserted into a map.
+	Exact duplicates are dropped here, keeping the last declaration.
+	"""
+	entries = {}
+	for name, types, urn in signatures:
+		if len(types) > MAX_SIGNATURE_ARGS:
+			raise Exception(f"{name} declares {len(types)} arguments, raise MAX_SIGNATURE_ARGS")
+		types = [normalize_type_name(t) for t in types]
+		# A single argument ending in `?` marks a function taking any number of
+		# arguments of that type (e.g. the variadic and/or)
+		variadic = len(types) == 1 and types[0].endswith("?")
+		kinds = tuple(kind_expression(t.rstrip("?")) for t in types)
+		key = (name, kinds, variadic)
+		entries.pop(key, None)
+		entries[key] = urn
+
+	lines = ""
+	for (name, kinds, variadic), urn in sorted(entries.items(), key=lambda entry: entry[0][0]):
+		kinds_str = "{" + ", ".join(kinds) + "}"
+		variadic_str = "true" if variadic else "false"
+		lines += f"    {{\"{name}\", \"{urn}\", {len(kinds)}, {kinds_str}, {variadic_str}}},\n"
+	return lines
+
+
+def write_custom_extension_file(signatures):
 	file_path  = os.path.join(os.path.dirname(os.path.realpath(__file__)),'..','src','custom_extensions_generated.cpp')
 	header = '''#include "custom_extensions/custom_extensions.hpp"
 
-//! This class is auto-generated by scripts/generate_custom_functions.py
+//! This file is auto-generated by scripts/generate_custom_functions.py
 //! It depends on the substrait-extensions extensions/*.yaml files
 namespace duckdb {
 
-void SubstraitCustomFunctions::Initialize() {
+using Type = substrait::Type;
+static constexpr SubstraitTypeKind ANY = SUBSTRAIT_ANY_KIND;
+static constexpr SubstraitTypeKind UNKNOWN = SUBSTRAIT_UNKNOWN_KIND;
+
+//! Every declared function signature, sorted by function name
+static constexpr SubstraitFunctionSignature FUNCTION_SIGNATURES[] = {
 '''
-	footer = '''}
+	footer = '''};
+
+const SubstraitFunctionSignature *SubstraitCustomFunctions::SignaturesBegin() {
+	return FUNCTION_SIGNATURES;
+}
 
-} // namespace duckdb'''
+const SubstraitFunctionSignature *SubstraitCustomFunctions::SignaturesEnd() {
+	return FUNCTION_SIGNATURES + sizeof(FUNCTION_SIGNATURES) / sizeof(FUNCTION_SIGNATURES[0]);
+}
+
+} // namespace duckdb
+'''
 
 	# Open the file in write mode
 	with open(file_path, 'w') as file:
 	# Write new content to the file
 		file.write(header)
-		file.write(custom_functions)
+		file.write(generate_signature_table(signatures))
 		file.write(footer)
 
 def resolve_extensions_folder():
@@ -135,10 +221,11 @@ def resolve_extensions_folder():
 	)
 	return os.path.join(tmp_dir, SUBSTRAIT_EXTENSIONS_SUBDIR), tmp_dir
 
-extensions_folder, tmp_dir = resolve_extensions_folder()
-try:
-	functions = get_custom_functions(extensions_folder)
-	write_custom_extension_file(functions)
-finally:
-	if tmp_dir is not None:
-		shutil.rmtree(tmp_dir, ignore_errors=True)
+if __name__ == "__main__":
+	extensions_folder, tmp_dir = resolve_extensions_folder()
+	try:
+		signatures = get_custom_functions(extensions_folder)
+		write_custom_extension_file(signatures)
+	finally:
+		if tmp_dir is not None:
+			shutil.rmtree(tmp_dir, ignore_errors=True)
@@ -2,119 +2,112 @@
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/string_util.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace duckdb {
 
-// Returns the name of the Type's set "kind" oneof field (e.g. "i32", "decimal",
-// "bool"). We use reflection rather than parsing DebugString(): modern protobuf
-// deliberately redacts DebugString() output (e.g. inserting "goo.gle/debugonly"),
-// which would otherwise be mistaken for the type name.
+// The names of the Type "kind" oneof fields (e.g. "i32", "decimal", "bool"),
+// indexed by their field number, which is also the value kind_case() returns
+// for them. They are read from the descriptor once, so naming a type is an
+// index lookup instead of a reflection call per argument. We don't parse
+// DebugString(): modern protobuf deliberately redacts its output (e.g.
+// inserting "goo.gle/debugonly"), which would be mistaken for the type name.
+static const vector<string> &GetKindNames() {
+	static const vector<string> kind_names = []() {
+		vector<string> names;
+		auto kind = substrait::Type::descriptor()->FindOneofByName("kind");
+		for (int i = 0; kind && i < kind->field_count(); i++) {
+			auto field = kind->field(i);
+			auto field_number = static_cast<idx_t>(field->number());
+			if (field_number >= names.size()) {
+				names.resize(field_number + 1);
+			}
+			names[field_number] = string(field->name());
+		}
+		return names;
+	}();
+	return kind_names;
+}
+
+// Returns the name of the Type's set "kind" oneof field, or an empty string if it has none
 string TransformTypes(const substrait::Type &type) {
-	auto *reflection = type.GetReflection();
-	auto *kind = type.GetDescriptor()->FindOneofByName("kind");
-	if (!kind) {
-		return "";
-	}
-	auto *field = reflection->GetOneofFieldDescriptor(type, kind);
-	if (!field) {
-		return "";
-	}
-	return string(field->name());
+	auto &kind_names = GetKindNames();
+	auto kind = static_cast<idx_t>(type.kind_case());
+	return kind < kind_names.size() ? kind_names[kind] : string();
 }
 
-// Concrete types over which an `any`/`any1` argument is expanded when
-// pre-building the overload maps. Each token is a protobuf Type.kind field name
-// (what TransformTypes() derives from a concrete argument), so the expanded
-// overloads match at lookup -- these are proto kind names, not the abbreviated
-// signature short names GetName() emits. This is the curated set of kinds that
-// occur as arguments, not an exhaustive list of every proto kind.
-vector<string> GetAllTypes() {
-	return {{"bool"},
-	        {"i8"},
-	        {"i16"},
-	        {"i32"},
-	        {"i64"},
-	        {"fp32"},
-	        {"fp64"},
-	        {"string"},
-	        {"binary"},
-	        {"date"},
-	        {"interval_year"},
-	        {"interval_day"},
-	        {"uuid"},
-	        {"varchar"},
-	        {"fixed_binary"},
-	        {"decimal"},
-	        {"precision_timestamp"},
-	        {"precision_timestamp_tz"}};
+// Concrete kinds an `any`/`any1` argument matches. This is the curated set of
+// kinds that occur as arguments, not an exhaustive list of every proto kind;
+// anything else falls back to a native function.
+static bool IsWildcardKind(SubstraitTypeKind kind) {
+	switch (kind) {
+	case substrait::Type::kBool:
+	case substrait::Type::kI8:
+	case substrait::Type::kI16:
+	case substrait::Type::kI32:
+	case substrait::Type::kI64:
+	case substrait::Type::kFp32:
+	case substrait::Type::kFp64:
+	case substrait::Type::kString:
+	case substrait::Type::kBinary:
+	case substrait::Type::kDate:
+	case substrait::Type::kIntervalYear:
+	case substrait::Type::kIntervalDay:
+	case substrait::Type::kUuid:
+	case substrait::Type::kVarchar:
+	case substrait::Type::kFixedBinary:
+	case substrait::Type::kDecimal:
+	case substrait::Type::kPrecisionTimestamp:
+	case substrait::Type::kPrecisionTimestampTz:
+		return true;
+	default:
+		return false;
+	}
 }
 
-// Recurse over the whole shebang
-void SubstraitCustomFunctions::InsertAllFunctions(const vector<vector<string>> &all_types, vector<idx_t> &indices,
-                                                  int depth, string &name, string &file_path) {
-	if (depth == indices.size()) {
-		vector<string> types;
-		for (idx_t i = 0; i < indices.size(); i++) {
-			auto type = all_types[i][indices[i]];
-			// Normalize the declared (YAML) type names to the protobuf Type.kind
-			// field names TransformTypes() produces at lookup, so overloads resolve
-			// regardless of the spelling difference (e.g. fixedchar -> fixed_char).
-			type = StringUtil::Replace(type, "boolean", "bool");
-			type = StringUtil::Replace(type, "fixedchar", "fixed_char");
-			type = StringUtil::Replace(type, "fixedbinary", "fixed_binary");
-			// functions_arithmetic_decimal spells the aggregate sum/avg argument
-			// `DECIMAL` (uppercase) while its scalar functions and every other
-			// extension use lowercase `decimal`; TransformTypes() only ever yields
-			// the lowercase proto kind name, so canonicalize the case here or the
-			// decimal sum/avg overloads never resolve.
-			type = StringUtil::Replace(type, "DECIMAL", "decimal");
-			types.push_back(type);
-		}
-		if (types.empty()) {
-			any_arg_functions[{name, types}] = {{name, types}, std::move(file_path)};
-		} else {
-			bool many_arg = false;
-			string type = types[0];
-			for (auto &t : types) {
-				if (!t.empty() && t[t.size() - 1] == '?') {
-					// If all types are equal and they end with ? we have a many_argument function
-					many_arg = type == t;
-				}
-			}
-			if (many_arg) {
-				many_arg_functions[{name, types}] = {{name, types}, std::move(file_path)};
-			} else {
-				custom_functions[{name, types}] = {{name, types}, std::move(file_path)};
-			}
-		}
+static bool MatchesKind(SubstraitTypeKind declared, SubstraitTypeKind kind) {
+	return declared == kind || (declared == SUBSTRAIT_ANY_KIND && IsWildcardKind(kind));
+}
 
-		return;
+static bool MatchesSignature(const SubstraitFunctionSignature &signature, const vector<SubstraitTypeKind> &kinds) {
+	if (signature.arg_count != kinds.size()) {
+		return false;
 	}
-	for (int i = 0; i < all_types[depth].size(); ++i) {
-		indices[depth] = i;
-		InsertAllFunctions(all_types, indices, depth + 1, name, file_path);
+	for (idx_t i = 0; i < kinds.size(); i++) {
+		if (!MatchesKind(signature.arg_kinds[i], kinds[i])) {
+			return false;
+		}
 	}
+	return true;
 }
 
-void SubstraitCustomFunctions::InsertCustomFunction(string name_p, vector<string> types_p, string file_path) {
-	auto types = std::move(types_p);
-	vector<vector<string>> all_types;
-	for (auto &t : types) {
-		if (t == "any1" || t == "any") {
-			all_types.emplace_back(GetAllTypes());
-		} else {
-			all_types.push_back({t});
+// A variadic signature (e.g. and:bool?) matches one or more arguments, all of its declared kind
+static bool MatchesVariadicSignature(const SubstraitFunctionSignature &signature,
+                                     const vector<SubstraitTypeKind> &kinds) {
+	if (!signature.variadic || kinds.empty()) {
+		return false;
+	}
+	for (auto &kind : kinds) {
+		if (kind != kinds[0] || !MatchesKind(signature.arg_kinds[0], kind)) {
+			return false;
 		}
 	}
-	// Get the number of dimensions
-	idx_t num_arguments = all_types.size();
-
-	// Create a vector to hold the indices
-	vector<idx_t> idx(num_arguments, 0);
-
-	// Call the helper function with initial depth 0
-	InsertAllFunctions(all_types, idx, 0, name_p, file_path);
+	return true;
 }
 
+struct CompareSignatureName {
+	bool operator()(const SubstraitFunctionSignature &signature, const char *name) const {
+		return strcmp(signature.name, name) < 0;
+	}
+	bool operator()(const char *name, const SubstraitFunctionSignature &signature) const {
+		return strcmp(name, signature.name) < 0;
+	}
+	bool operator()(const SubstraitFunctionSignature &left, const SubstraitFunctionSignature &right) const {
+		return strcmp(left.name, right.name) < 0;
+	}
+};
+
 // Maps a Substrait type name (the protobuf `Type.kind` oneof field name, e.g.
 // "string", "decimal", "precision_timestamp") to the abbreviated "Type Short
 // Name" that compound function signatures must use, per
@@ -171,10 +164,6 @@ bool SubstraitFunctionExtensions::IsNative() const {
 	return extension_path == "native";
 }
 
-SubstraitCustomFunctions::SubstraitCustomFunctions() {
-	Initialize();
-};
-
 vector<string> SubstraitCustomFunctions::GetTypes(const vector<substrait::Type> &types) {
 	vector<string> transformed_types;
 	for (auto &type : types) {
@@ -186,46 +175,34 @@ vector<string> SubstraitCustomFunctions::GetTypes(const vector<substrait::Type>
 // FIXME: We might have to do DuckDB extensions at some point
 SubstraitFunctionExtensions SubstraitCustomFunctions::Get(const string &name,
                                                           const vector<::substrait::Type> &types) const {
-	vector<string> transformed_types;
-	if (types.empty()) {
-		SubstraitCustomFunction custom_function {name, {}};
-		auto it = any_arg_functions.find(custom_function);
-		if (it != custom_functions.end()) {
-			// We found it in our substrait custom map, return that
-			return it->second;
-		}
-		return {{name, {}}, "native"};
-	}
-
+	vector<SubstraitTypeKind> kinds;
+	kinds.reserve(types.size());
 	for (auto &type : types) {
-		transformed_types.emplace_back(TransformTypes(type));
-		if (transformed_types.back().empty()) {
-			// If it is empty it means we did not find a yaml extension, we return the function name
+		if (type.kind_case() == substrait::Type::KIND_NOT_SET) {
+			// We can't match an argument without a type, we return the function name
 			return {{name, {}}, "native"};
 		}
+		kinds.push_back(type.kind_case());
 	}
-	{
-		SubstraitCustomFunction custom_function {name, {transformed_types}};
-		auto it = custom_functions.find(custom_function);
-		if (it != custom_functions.end()) {
-			// We found it in our substrait custom map, return that
-			return it->second;
+
+	// Overloads of a function are stored in declaration order; when several of them match, the last declared one
+	// wins. Variadic signatures are only considered if no signature matches the arguments one by one.
+	auto range = std::equal_range(SignaturesBegin(), SignaturesEnd(), name.c_str(), CompareSignatureName());
+	const SubstraitFunctionSignature *match = nullptr;
+	const SubstraitFunctionSignature *variadic_match = nullptr;
+	for (auto signature = range.first; signature != range.second; signature++) {
+		if (MatchesSignature(*signature, kinds)) {
+			match = signature;
+		} else if (MatchesVariadicSignature(*signature, kinds)) {
+			variadic_match = signature;
 		}
 	}
-
-	// check if it's a many argument fit
-	bool possibly_many_arg = true;
-	string type = transformed_types[0];
-	for (auto &t : transformed_types) {
-		possibly_many_arg = possibly_many_arg && type == t;
+	if (match) {
+		return {{name, GetTypes(types)}, match->urn};
 	}
-	if (possibly_many_arg) {
-		type += '?';
-		SubstraitCustomFunction custom_many_function {name, {{type}}};
-		auto many_it = many_arg_functions.find(custom_many_function);
-		if (many_it != many_arg_functions.end()) {
-			return many_it->second;
-		}
+	if (variadic_match) {
+		// The compound name of a variadic function only carries its single declared argument type
+		return {{name, {TransformTypes(types[0])}}, variadic_match->urn};
 	}
 	// TODO: check if this should also print the arg types or not
 	// we did not find it, return it as a native substrait function
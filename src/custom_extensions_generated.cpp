@@ -1,512 +1,515 @@
 #include "custom_extensions/custom_extensions.hpp"
 
-//! This class is auto-generated by scripts/generate_custom_functions.py
+//! This file is auto-generated by scripts/generate_custom_functions.py
 //! It depends on the substrait-extensions extensions/*.yaml files
 namespace duckdb {
 
-void SubstraitCustomFunctions::Initialize() {
-	InsertCustomFunction("extract", {"precision_timestamp_tz", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"precision_time"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"precision_timestamp_tz", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract", {"date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract_boolean", {"precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract_boolean", {"precision_timestamp_tz", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("extract_boolean", {"date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"precision_timestamp", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"precision_timestamp_tz", "interval_year", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"date", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"precision_timestamp", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"precision_timestamp_tz", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add", {"date", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i8", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i16", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i32", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i64", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i8", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i16", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i32", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("multiply", {"i64", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add_intervals", {"interval_day", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("add_intervals", {"interval_year", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"precision_timestamp", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"precision_timestamp_tz", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"precision_timestamp_tz", "interval_year", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"date", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"precision_timestamp", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"precision_timestamp_tz", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("subtract", {"date", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lte", {"precision_timestamp", "precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lte", {"precision_timestamp_tz", "precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lte", {"date", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lte", {"interval_day", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lte", {"interval_year", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lt", {"precision_timestamp", "precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lt", {"precision_timestamp_tz", "precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lt", {"date", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lt", {"interval_day", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("lt", {"interval_year", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gte", {"precision_timestamp", "precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gte", {"precision_timestamp_tz", "precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gte", {"date", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gte", {"interval_day", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gte", {"interval_year", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gt", {"precision_timestamp", "precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gt", {"precision_timestamp_tz", "precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gt", {"date", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gt", {"interval_day", "interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("gt", {"interval_year", "interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("assume_timezone", {"precision_timestamp", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("assume_timezone", {"date", "string", "i8"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("local_timestamp", {"precision_timestamp_tz", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strptime_time", {"string", "string", "i8"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strptime_date", {"string", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strptime_timestamp", {"string", "string", "string", "i8"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strptime_timestamp", {"string", "string", "i8"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strftime", {"precision_timestamp", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strftime", {"precision_timestamp_tz", "string", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strftime", {"date", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("strftime", {"precision_time", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_temporal", {"precision_timestamp", "i64", "precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_temporal", {"precision_timestamp_tz", "i64", "string", "precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_temporal", {"date", "i64", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_temporal", {"precision_time", "i64", "precision_time"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_calendar", {"precision_timestamp", "i64"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_calendar", {"precision_timestamp_tz", "i64", "string"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_calendar", {"date", "i64", "date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("round_calendar", {"precision_time", "i64", "precision_time"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"precision_time"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("min", {"interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"date"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"precision_time"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"precision_timestamp"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"precision_timestamp_tz"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"interval_day"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("max", {"interval_year"}, "extension:io.substrait:functions_datetime");
-	InsertCustomFunction("not_equal", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("equal", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_not_distinct_from", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_distinct_from", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("lt", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("gt", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("lte", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("gte", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("between", {"any1", "any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_true", {"boolean"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_not_true", {"boolean"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_false", {"boolean"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_not_false", {"boolean"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_null", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_not_null", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_nan", {"fp32"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_nan", {"fp64"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_finite", {"fp32"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_finite", {"fp64"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_infinite", {"fp32"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("is_infinite", {"fp64"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("nullif", {"any1", "any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("coalesce", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("least", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("least_skip_null", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("greatest", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("greatest_skip_null", {"any1"}, "extension:io.substrait:functions_comparison");
-	InsertCustomFunction("point", {"fp64", "fp64"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("make_line", {"u!geometry", "u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("x_coordinate", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("y_coordinate", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("num_points", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("is_empty", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("is_closed", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("is_simple", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("is_ring", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("geometry_type", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("envelope", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("dimension", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("is_valid", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("collection_extract", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("collection_extract", {"u!geometry", "i8"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("flip_coordinates", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("remove_repeated_points", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("remove_repeated_points", {"u!geometry", "fp64"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("buffer", {"u!geometry", "fp64"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("centroid", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("minimum_bounding_circle", {"u!geometry"}, "extension:io.substrait:functions_geometry");
-	InsertCustomFunction("approx_count_distinct", {"any"}, "extension:io.substrait:functions_aggregate_approx");
-	InsertCustomFunction("count", {"any"}, "extension:io.substrait:functions_aggregate_decimal_output");
-	InsertCustomFunction("count", {}, "extension:io.substrait:functions_aggregate_decimal_output");
-	InsertCustomFunction("approx_count_distinct", {"any"}, "extension:io.substrait:functions_aggregate_decimal_output");
-	InsertCustomFunction("ceil", {"decimal"}, "extension:io.substrait:functions_rounding_decimal");
-	InsertCustomFunction("floor", {"decimal"}, "extension:io.substrait:functions_rounding_decimal");
-	InsertCustomFunction("round", {"decimal", "i32"}, "extension:io.substrait:functions_rounding_decimal");
-	InsertCustomFunction("transform", {"list", "func any2>"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("filter", {"list", "func boolean?>"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("cardinality", {"list"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("sort", {"list"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("any_match", {"list", "func boolean?>"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("all_match", {"list", "func boolean?>"}, "extension:io.substrait:functions_list");
-	InsertCustomFunction("ln", {"i64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("ln", {"fp32"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("ln", {"fp64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("ln", {"decimal"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log10", {"i64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log10", {"fp32"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log10", {"fp64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log10", {"decimal"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log2", {"i64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log2", {"fp32"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log2", {"fp64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log2", {"decimal"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("logb", {"i64", "i64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("logb", {"fp32", "fp32"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("logb", {"fp64", "fp64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("logb", {"decimal", "decimal"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log1p", {"fp32"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log1p", {"fp64"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("log1p", {"decimal"}, "extension:io.substrait:functions_logarithmic");
-	InsertCustomFunction("concat", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("concat", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("like", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("like", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"varchar", "i32", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"string", "i32", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"fixedchar", "i32", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"varchar", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"string", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("substring", {"fixedchar", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_match_substring", {"varchar", "varchar", "i64", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_match_substring", {"string", "string", "i64", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_match_substring", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_match_substring_all", {"varchar", "varchar", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_match_substring_all", {"string", "string", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"varchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"varchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"string", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"string", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"fixedchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"fixedchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("starts_with", {"fixedchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"varchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"varchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"string", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"string", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"fixedchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"fixedchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ends_with", {"fixedchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"varchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"varchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"string", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"string", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"fixedchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"fixedchar", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("contains", {"fixedchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("strpos", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("strpos", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("strpos", {"fixedchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_strpos", {"varchar", "varchar", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_strpos", {"string", "string", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("count_substring", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("count_substring", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("count_substring", {"fixedchar", "fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_count_substring", {"string", "string", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_count_substring", {"varchar", "varchar", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_count_substring", {"fixedchar", "fixedchar", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_count_substring", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("replace", {"string", "string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("replace", {"varchar", "varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("concat_ws", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("concat_ws", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("repeat", {"string", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("repeat", {"varchar", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("reverse", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("reverse", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("reverse", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("replace_slice", {"string", "i64", "i64", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("replace_slice", {"varchar", "i64", "i64", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("lower", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("lower", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("lower", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("upper", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("upper", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("upper", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("swapcase", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("swapcase", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("swapcase", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("capitalize", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("capitalize", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("capitalize", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("title", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("title", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("title", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("initcap", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("initcap", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("initcap", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("char_length", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("char_length", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("char_length", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("bit_length", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("bit_length", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("bit_length", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("octet_length", {"string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("octet_length", {"varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("octet_length", {"fixedchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_replace", {"string", "string", "string", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_replace", {"varchar", "varchar", "varchar", "i64", "i64"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_replace", {"string", "string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ltrim", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("ltrim", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("rtrim", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("rtrim", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("trim", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("trim", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("lpad", {"varchar", "i32", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("lpad", {"string", "i32", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("rpad", {"varchar", "i32", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("rpad", {"string", "i32", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("center", {"varchar", "i32", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("center", {"string", "i32", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("left", {"varchar", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("left", {"string", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("right", {"varchar", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("right", {"string", "i32"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("string_split", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("string_split", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_string_split", {"varchar", "varchar"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("regexp_string_split", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("string_agg", {"string", "string"}, "extension:io.substrait:functions_string");
-	InsertCustomFunction("add", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("add", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("add", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("add", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("add", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("add", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("subtract", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("multiply", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("divide", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("negate", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("modulus", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("modulus", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("modulus", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("modulus", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("power", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("power", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("power", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sqrt", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sqrt", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sqrt", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("exp", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("exp", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("exp", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("cos", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("cos", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sin", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sin", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("tan", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("tan", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("cosh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("cosh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sinh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sinh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("tanh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("tanh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("acos", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("acos", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("asin", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("asin", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atan", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atan", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("acosh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("acosh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("asinh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("asinh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atanh", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atanh", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atan2", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("atan2", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("radians", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("radians", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("degrees", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("degrees", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("abs", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sign", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("factorial", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("factorial", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_not", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_not", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_not", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_not", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_and", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_and", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_and", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_and", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_or", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_or", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_or", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_or", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_xor", {"i8", "i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_xor", {"i16", "i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_xor", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("bitwise_xor", {"i64", "i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_left", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_left", {"i64", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_right", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_right", {"i64", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_right_unsigned", {"i32", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("shift_right_unsigned", {"i64", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("sum0", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("avg", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("min", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("max", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("product", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("std_dev", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("std_dev", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("std_dev", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("std_dev", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("variance", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("variance", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("variance", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("variance", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("corr", {"fp32", "fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("corr", {"fp64", "fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("mode", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"i8"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"i16"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"fp32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("median", {"fp64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("quantile", {"i64", "any"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("row_number", {}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("rank", {}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("dense_rank", {}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("percent_rank", {}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("cume_dist", {}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("ntile", {"i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("ntile", {"i64"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("first_value", {"any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("last_value", {"any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("nth_value", {"any1", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lead", {"any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lead", {"any1", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lead", {"any1", "i32", "any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lag", {"any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lag", {"any1", "i32"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("lag", {"any1", "i32", "any1"}, "extension:io.substrait:functions_arithmetic");
-	InsertCustomFunction("ceil", {"fp32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("ceil", {"fp64"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("floor", {"fp32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("floor", {"fp64"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"i8", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"i16", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"i32", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"i64", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"fp32", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("round", {"fp64", "i32"}, "extension:io.substrait:functions_rounding");
-	InsertCustomFunction("count", {"any"}, "extension:io.substrait:functions_aggregate_generic");
-	InsertCustomFunction("count", {}, "extension:io.substrait:functions_aggregate_generic");
-	InsertCustomFunction("any_value", {"any1"}, "extension:io.substrait:functions_aggregate_generic");
-	InsertCustomFunction("or", {"boolean?"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("and", {"boolean?"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("and_not", {"boolean?", "boolean?"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("xor", {"boolean?", "boolean?"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("not", {"boolean?"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("bool_and", {"boolean"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("bool_or", {"boolean"}, "extension:io.substrait:functions_boolean");
-	InsertCustomFunction("add", {"decimal", "decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("subtract", {"decimal", "decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("multiply", {"decimal", "decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("divide", {"decimal", "decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("modulus", {"decimal", "decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("abs", {"decimal"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("bitwise_and", {"DECIMAL", "DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("bitwise_or", {"DECIMAL", "DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("bitwise_xor", {"DECIMAL", "DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("sqrt", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("factorial", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("power", {"DECIMAL", "DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("sum", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("avg", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("min", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("max", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("sum0", {"DECIMAL"}, "extension:io.substrait:functions_arithmetic_decimal");
-	InsertCustomFunction("index_in", {"any1", "list"}, "extension:io.substrait:functions_set");
+using Type = substrait::Type;
+static constexpr SubstraitTypeKind ANY = SUBSTRAIT_ANY_KIND;
+static constexpr SubstraitTypeKind UNKNOWN = SUBSTRAIT_UNKNOWN_KIND;
+
+//! Every declared function signature, sorted by function name
+static constexpr SubstraitFunctionSignature FUNCTION_SIGNATURES[] = {
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"abs", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"acos", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"acos", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"acosh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"acosh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"add", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kIntervalYear}, false},
+    {"add", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTimestampTz, Type::kIntervalYear, Type::kString}, false},
+    {"add", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kIntervalYear}, false},
+    {"add", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kIntervalDay}, false},
+    {"add", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kIntervalDay}, false},
+    {"add", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kIntervalDay}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"add", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"add", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"add_intervals", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalDay, Type::kIntervalDay}, false},
+    {"add_intervals", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalYear, Type::kIntervalYear}, false},
+    {"all_match", "extension:io.substrait:functions_list", 2, {Type::kList, UNKNOWN}, false},
+    {"and", "extension:io.substrait:functions_boolean", 1, {Type::kBool}, true},
+    {"and_not", "extension:io.substrait:functions_boolean", 2, {Type::kBool, Type::kBool}, false},
+    {"any_match", "extension:io.substrait:functions_list", 2, {Type::kList, UNKNOWN}, false},
+    {"any_value", "extension:io.substrait:functions_aggregate_generic", 1, {ANY}, false},
+    {"approx_count_distinct", "extension:io.substrait:functions_aggregate_decimal_output", 1, {ANY}, false},
+    {"asin", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"asin", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"asinh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"asinh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"assume_timezone", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kString}, false},
+    {"assume_timezone", "extension:io.substrait:functions_datetime", 3, {Type::kDate, Type::kString, Type::kI8}, false},
+    {"atan", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"atan", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"atan2", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"atan2", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"atanh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"atanh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"avg", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"between", "extension:io.substrait:functions_comparison", 3, {ANY, ANY, ANY}, false},
+    {"bit_length", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"bit_length", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"bit_length", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"bitwise_and", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"bitwise_and", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"bitwise_and", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"bitwise_and", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"bitwise_and", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"bitwise_not", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"bitwise_not", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"bitwise_not", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"bitwise_not", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"bitwise_or", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"bitwise_or", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"bitwise_or", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"bitwise_or", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"bitwise_or", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"bitwise_xor", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"bitwise_xor", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"bitwise_xor", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"bitwise_xor", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"bitwise_xor", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"bool_and", "extension:io.substrait:functions_boolean", 1, {Type::kBool}, false},
+    {"bool_or", "extension:io.substrait:functions_boolean", 1, {Type::kBool}, false},
+    {"buffer", "extension:io.substrait:functions_geometry", 2, {UNKNOWN, Type::kFp64}, false},
+    {"capitalize", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"capitalize", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"capitalize", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"cardinality", "extension:io.substrait:functions_list", 1, {Type::kList}, false},
+    {"ceil", "extension:io.substrait:functions_rounding_decimal", 1, {Type::kDecimal}, false},
+    {"ceil", "extension:io.substrait:functions_rounding", 1, {Type::kFp32}, false},
+    {"ceil", "extension:io.substrait:functions_rounding", 1, {Type::kFp64}, false},
+    {"center", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kI32, Type::kVarchar}, false},
+    {"center", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kI32, Type::kString}, false},
+    {"centroid", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"char_length", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"char_length", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"char_length", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"coalesce", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"collection_extract", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"collection_extract", "extension:io.substrait:functions_geometry", 2, {UNKNOWN, Type::kI8}, false},
+    {"concat", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"concat", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"concat_ws", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"concat_ws", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kString}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kFixedChar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kVarchar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kFixedChar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kFixedChar}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kString}, false},
+    {"contains", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kVarchar}, false},
+    {"corr", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"corr", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"cos", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"cos", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"cosh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"cosh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"count", "extension:io.substrait:functions_aggregate_generic", 1, {ANY}, false},
+    {"count", "extension:io.substrait:functions_aggregate_generic", 0, {}, false},
+    {"count_substring", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"count_substring", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"count_substring", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kFixedChar}, false},
+    {"cume_dist", "extension:io.substrait:functions_arithmetic", 0, {}, false},
+    {"degrees", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"degrees", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"dense_rank", "extension:io.substrait:functions_arithmetic", 0, {}, false},
+    {"dimension", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"divide", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kString}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kFixedChar}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kVarchar}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kFixedChar}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kFixedChar}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kString}, false},
+    {"ends_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kVarchar}, false},
+    {"envelope", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"equal", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"exp", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"exp", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"exp", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"extract", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTime}, false},
+    {"extract", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kString}, false},
+    {"extract", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestamp}, false},
+    {"extract", "extension:io.substrait:functions_datetime", 1, {Type::kDate}, false},
+    {"extract_boolean", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestamp}, false},
+    {"extract_boolean", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kString}, false},
+    {"extract_boolean", "extension:io.substrait:functions_datetime", 1, {Type::kDate}, false},
+    {"factorial", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"factorial", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"factorial", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"filter", "extension:io.substrait:functions_list", 2, {Type::kList, UNKNOWN}, false},
+    {"first_value", "extension:io.substrait:functions_arithmetic", 1, {ANY}, false},
+    {"flip_coordinates", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"floor", "extension:io.substrait:functions_rounding_decimal", 1, {Type::kDecimal}, false},
+    {"floor", "extension:io.substrait:functions_rounding", 1, {Type::kFp32}, false},
+    {"floor", "extension:io.substrait:functions_rounding", 1, {Type::kFp64}, false},
+    {"geometry_type", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"greatest", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"greatest_skip_null", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"gt", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kPrecisionTimestamp}, false},
+    {"gt", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kPrecisionTimestampTz}, false},
+    {"gt", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kDate}, false},
+    {"gt", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalDay, Type::kIntervalDay}, false},
+    {"gt", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalYear, Type::kIntervalYear}, false},
+    {"gt", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"gte", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kPrecisionTimestamp}, false},
+    {"gte", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kPrecisionTimestampTz}, false},
+    {"gte", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kDate}, false},
+    {"gte", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalDay, Type::kIntervalDay}, false},
+    {"gte", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalYear, Type::kIntervalYear}, false},
+    {"gte", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"index_in", "extension:io.substrait:functions_set", 2, {ANY, Type::kList}, false},
+    {"initcap", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"initcap", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"initcap", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"is_closed", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"is_distinct_from", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"is_empty", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"is_false", "extension:io.substrait:functions_comparison", 1, {Type::kBool}, false},
+    {"is_finite", "extension:io.substrait:functions_comparison", 1, {Type::kFp32}, false},
+    {"is_finite", "extension:io.substrait:functions_comparison", 1, {Type::kFp64}, false},
+    {"is_infinite", "extension:io.substrait:functions_comparison", 1, {Type::kFp32}, false},
+    {"is_infinite", "extension:io.substrait:functions_comparison", 1, {Type::kFp64}, false},
+    {"is_nan", "extension:io.substrait:functions_comparison", 1, {Type::kFp32}, false},
+    {"is_nan", "extension:io.substrait:functions_comparison", 1, {Type::kFp64}, false},
+    {"is_not_distinct_from", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"is_not_false", "extension:io.substrait:functions_comparison", 1, {Type::kBool}, false},
+    {"is_not_null", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"is_not_true", "extension:io.substrait:functions_comparison", 1, {Type::kBool}, false},
+    {"is_null", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"is_ring", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"is_simple", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"is_true", "extension:io.substrait:functions_comparison", 1, {Type::kBool}, false},
+    {"is_valid", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"lag", "extension:io.substrait:functions_arithmetic", 1, {ANY}, false},
+    {"lag", "extension:io.substrait:functions_arithmetic", 2, {ANY, Type::kI32}, false},
+    {"lag", "extension:io.substrait:functions_arithmetic", 3, {ANY, Type::kI32, ANY}, false},
+    {"last_value", "extension:io.substrait:functions_arithmetic", 1, {ANY}, false},
+    {"lead", "extension:io.substrait:functions_arithmetic", 1, {ANY}, false},
+    {"lead", "extension:io.substrait:functions_arithmetic", 2, {ANY, Type::kI32}, false},
+    {"lead", "extension:io.substrait:functions_arithmetic", 3, {ANY, Type::kI32, ANY}, false},
+    {"least", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"least_skip_null", "extension:io.substrait:functions_comparison", 1, {ANY}, false},
+    {"left", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kI32}, false},
+    {"left", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kI32}, false},
+    {"like", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"like", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"ln", "extension:io.substrait:functions_logarithmic", 1, {Type::kI64}, false},
+    {"ln", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp32}, false},
+    {"ln", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp64}, false},
+    {"ln", "extension:io.substrait:functions_logarithmic", 1, {Type::kDecimal}, false},
+    {"local_timestamp", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kString}, false},
+    {"log10", "extension:io.substrait:functions_logarithmic", 1, {Type::kI64}, false},
+    {"log10", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp32}, false},
+    {"log10", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp64}, false},
+    {"log10", "extension:io.substrait:functions_logarithmic", 1, {Type::kDecimal}, false},
+    {"log1p", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp32}, false},
+    {"log1p", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp64}, false},
+    {"log1p", "extension:io.substrait:functions_logarithmic", 1, {Type::kDecimal}, false},
+    {"log2", "extension:io.substrait:functions_logarithmic", 1, {Type::kI64}, false},
+    {"log2", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp32}, false},
+    {"log2", "extension:io.substrait:functions_logarithmic", 1, {Type::kFp64}, false},
+    {"log2", "extension:io.substrait:functions_logarithmic", 1, {Type::kDecimal}, false},
+    {"logb", "extension:io.substrait:functions_logarithmic", 2, {Type::kI64, Type::kI64}, false},
+    {"logb", "extension:io.substrait:functions_logarithmic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"logb", "extension:io.substrait:functions_logarithmic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"logb", "extension:io.substrait:functions_logarithmic", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"lower", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"lower", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"lower", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"lpad", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kI32, Type::kVarchar}, false},
+    {"lpad", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kI32, Type::kString}, false},
+    {"lt", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kPrecisionTimestamp}, false},
+    {"lt", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kPrecisionTimestampTz}, false},
+    {"lt", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kDate}, false},
+    {"lt", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalDay, Type::kIntervalDay}, false},
+    {"lt", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalYear, Type::kIntervalYear}, false},
+    {"lt", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"lte", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kPrecisionTimestamp}, false},
+    {"lte", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kPrecisionTimestampTz}, false},
+    {"lte", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kDate}, false},
+    {"lte", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalDay, Type::kIntervalDay}, false},
+    {"lte", "extension:io.substrait:functions_datetime", 2, {Type::kIntervalYear, Type::kIntervalYear}, false},
+    {"lte", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"ltrim", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"ltrim", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"make_line", "extension:io.substrait:functions_geometry", 2, {UNKNOWN, UNKNOWN}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kDate}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTime}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestamp}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestampTz}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kIntervalDay}, false},
+    {"max", "extension:io.substrait:functions_datetime", 1, {Type::kIntervalYear}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"max", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"max", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"median", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kDate}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTime}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestamp}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kPrecisionTimestampTz}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kIntervalDay}, false},
+    {"min", "extension:io.substrait:functions_datetime", 1, {Type::kIntervalYear}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"min", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"min", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"minimum_bounding_circle", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"mode", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"modulus", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"modulus", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"modulus", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"modulus", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"modulus", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI8, Type::kIntervalDay}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI16, Type::kIntervalDay}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI32, Type::kIntervalDay}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI64, Type::kIntervalDay}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI8, Type::kIntervalYear}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI16, Type::kIntervalYear}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI32, Type::kIntervalYear}, false},
+    {"multiply", "extension:io.substrait:functions_datetime", 2, {Type::kI64, Type::kIntervalYear}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"multiply", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"negate", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"not", "extension:io.substrait:functions_boolean", 1, {Type::kBool}, true},
+    {"not_equal", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"nth_value", "extension:io.substrait:functions_arithmetic", 2, {ANY, Type::kI32}, false},
+    {"ntile", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"ntile", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"nullif", "extension:io.substrait:functions_comparison", 2, {ANY, ANY}, false},
+    {"num_points", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"octet_length", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"octet_length", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"octet_length", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"or", "extension:io.substrait:functions_boolean", 1, {Type::kBool}, true},
+    {"percent_rank", "extension:io.substrait:functions_arithmetic", 0, {}, false},
+    {"point", "extension:io.substrait:functions_geometry", 2, {Type::kFp64, Type::kFp64}, false},
+    {"power", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"power", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"power", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"power", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"product", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"quantile", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, ANY}, false},
+    {"radians", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"radians", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"rank", "extension:io.substrait:functions_arithmetic", 0, {}, false},
+    {"regexp_count_substring", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kString, Type::kI64}, false},
+    {"regexp_count_substring", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kVarchar, Type::kI64}, false},
+    {"regexp_count_substring", "extension:io.substrait:functions_string", 3, {Type::kFixedChar, Type::kFixedChar, Type::kI64}, false},
+    {"regexp_count_substring", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"regexp_match_substring", "extension:io.substrait:functions_string", 5, {Type::kVarchar, Type::kVarchar, Type::kI64, Type::kI64, Type::kI64}, false},
+    {"regexp_match_substring", "extension:io.substrait:functions_string", 5, {Type::kString, Type::kString, Type::kI64, Type::kI64, Type::kI64}, false},
+    {"regexp_match_substring", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"regexp_match_substring_all", "extension:io.substrait:functions_string", 4, {Type::kVarchar, Type::kVarchar, Type::kI64, Type::kI64}, false},
+    {"regexp_match_substring_all", "extension:io.substrait:functions_string", 4, {Type::kString, Type::kString, Type::kI64, Type::kI64}, false},
+    {"regexp_replace", "extension:io.substrait:functions_string", 5, {Type::kString, Type::kString, Type::kString, Type::kI64, Type::kI64}, false},
+    {"regexp_replace", "extension:io.substrait:functions_string", 5, {Type::kVarchar, Type::kVarchar, Type::kVarchar, Type::kI64, Type::kI64}, false},
+    {"regexp_replace", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kString, Type::kString}, false},
+    {"regexp_string_split", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"regexp_string_split", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"regexp_strpos", "extension:io.substrait:functions_string", 4, {Type::kVarchar, Type::kVarchar, Type::kI64, Type::kI64}, false},
+    {"regexp_strpos", "extension:io.substrait:functions_string", 4, {Type::kString, Type::kString, Type::kI64, Type::kI64}, false},
+    {"remove_repeated_points", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"remove_repeated_points", "extension:io.substrait:functions_geometry", 2, {UNKNOWN, Type::kFp64}, false},
+    {"repeat", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kI64}, false},
+    {"repeat", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kI64}, false},
+    {"replace", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kString, Type::kString}, false},
+    {"replace", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kVarchar, Type::kVarchar}, false},
+    {"replace_slice", "extension:io.substrait:functions_string", 4, {Type::kString, Type::kI64, Type::kI64, Type::kString}, false},
+    {"replace_slice", "extension:io.substrait:functions_string", 4, {Type::kVarchar, Type::kI64, Type::kI64, Type::kVarchar}, false},
+    {"reverse", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"reverse", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"reverse", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"right", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kI32}, false},
+    {"right", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding_decimal", 2, {Type::kDecimal, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kI8, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kI16, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kI32, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kI64, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kFp32, Type::kI32}, false},
+    {"round", "extension:io.substrait:functions_rounding", 2, {Type::kFp64, Type::kI32}, false},
+    {"round_calendar", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kI64}, false},
+    {"round_calendar", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTimestampTz, Type::kI64, Type::kString}, false},
+    {"round_calendar", "extension:io.substrait:functions_datetime", 3, {Type::kDate, Type::kI64, Type::kDate}, false},
+    {"round_calendar", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTime, Type::kI64, Type::kPrecisionTime}, false},
+    {"round_temporal", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTimestamp, Type::kI64, Type::kPrecisionTimestamp}, false},
+    {"round_temporal", "extension:io.substrait:functions_datetime", 4, {Type::kPrecisionTimestampTz, Type::kI64, Type::kString, Type::kPrecisionTimestampTz}, false},
+    {"round_temporal", "extension:io.substrait:functions_datetime", 3, {Type::kDate, Type::kI64, Type::kDate}, false},
+    {"round_temporal", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTime, Type::kI64, Type::kPrecisionTime}, false},
+    {"row_number", "extension:io.substrait:functions_arithmetic", 0, {}, false},
+    {"rpad", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kI32, Type::kVarchar}, false},
+    {"rpad", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kI32, Type::kString}, false},
+    {"rtrim", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"rtrim", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"shift_left", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"shift_left", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI32}, false},
+    {"shift_right", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"shift_right", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI32}, false},
+    {"shift_right_unsigned", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"shift_right_unsigned", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI32}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sign", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sin", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sin", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sinh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sinh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sort", "extension:io.substrait:functions_list", 1, {Type::kList}, false},
+    {"sqrt", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"sqrt", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sqrt", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sqrt", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kString}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kFixedChar}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kVarchar}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kFixedChar}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kFixedChar}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kString}, false},
+    {"starts_with", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kVarchar}, false},
+    {"std_dev", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"std_dev", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"strftime", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kString}, false},
+    {"strftime", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTimestampTz, Type::kString, Type::kString}, false},
+    {"strftime", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kString}, false},
+    {"strftime", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTime, Type::kString}, false},
+    {"string_agg", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"string_split", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"string_split", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"strpos", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"strpos", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"strpos", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kFixedChar}, false},
+    {"strptime_date", "extension:io.substrait:functions_datetime", 2, {Type::kString, Type::kString}, false},
+    {"strptime_time", "extension:io.substrait:functions_datetime", 3, {Type::kString, Type::kString, Type::kI8}, false},
+    {"strptime_timestamp", "extension:io.substrait:functions_datetime", 4, {Type::kString, Type::kString, Type::kString, Type::kI8}, false},
+    {"strptime_timestamp", "extension:io.substrait:functions_datetime", 3, {Type::kString, Type::kString, Type::kI8}, false},
+    {"substring", "extension:io.substrait:functions_string", 3, {Type::kVarchar, Type::kI32, Type::kI32}, false},
+    {"substring", "extension:io.substrait:functions_string", 3, {Type::kString, Type::kI32, Type::kI32}, false},
+    {"substring", "extension:io.substrait:functions_string", 3, {Type::kFixedChar, Type::kI32, Type::kI32}, false},
+    {"substring", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kI32}, false},
+    {"substring", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kI32}, false},
+    {"substring", "extension:io.substrait:functions_string", 2, {Type::kFixedChar, Type::kI32}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kIntervalYear}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kIntervalYear}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 3, {Type::kPrecisionTimestampTz, Type::kIntervalYear, Type::kString}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kIntervalYear}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestamp, Type::kIntervalDay}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kPrecisionTimestampTz, Type::kIntervalDay}, false},
+    {"subtract", "extension:io.substrait:functions_datetime", 2, {Type::kDate, Type::kIntervalDay}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kI8, Type::kI8}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kI16, Type::kI16}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kI32, Type::kI32}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kI64, Type::kI64}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp32, Type::kFp32}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic", 2, {Type::kFp64, Type::kFp64}, false},
+    {"subtract", "extension:io.substrait:functions_arithmetic_decimal", 2, {Type::kDecimal, Type::kDecimal}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sum", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kI8}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kI16}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kI32}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kI64}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"sum0", "extension:io.substrait:functions_arithmetic_decimal", 1, {Type::kDecimal}, false},
+    {"swapcase", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"swapcase", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"swapcase", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"tan", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"tan", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"tanh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"tanh", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"title", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"title", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"title", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"transform", "extension:io.substrait:functions_list", 2, {Type::kList, UNKNOWN}, false},
+    {"trim", "extension:io.substrait:functions_string", 2, {Type::kVarchar, Type::kVarchar}, false},
+    {"trim", "extension:io.substrait:functions_string", 2, {Type::kString, Type::kString}, false},
+    {"upper", "extension:io.substrait:functions_string", 1, {Type::kString}, false},
+    {"upper", "extension:io.substrait:functions_string", 1, {Type::kVarchar}, false},
+    {"upper", "extension:io.substrait:functions_string", 1, {Type::kFixedChar}, false},
+    {"variance", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp32}, false},
+    {"variance", "extension:io.substrait:functions_arithmetic", 1, {Type::kFp64}, false},
+    {"x_coordinate", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+    {"xor", "extension:io.substrait:functions_boolean", 2, {Type::kBool, Type::kBool}, false},
+    {"y_coordinate", "extension:io.substrait:functions_geometry", 1, {UNKNOWN}, false},
+};
+
+const SubstraitFunctionSignature *SubstraitCustomFunctions::SignaturesBegin() {
+	return FUNCTION_SIGNATURES;
+}
+
+const SubstraitFunctionSignature *SubstraitCustomFunctions::SignaturesEnd() {
+	return FUNCTION_SIGNATURES + sizeof(FUNCTION_SIGNATURES) / sizeof(FUNCTION_SIGNATURES[0]);
 }
 
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
@@ -3,10 +3,13 @@
 #include <cinttypes>
 #include <cmath>
 
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/parser/expression/list.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/shared_ptr.hpp"
@@ -17,6 +20,8 @@
 #include "duckdb/parser/expression/comparison_expression.hpp"
 
 #include "duckdb/main/client_data.hpp"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/unknown_field_set.h"
 #include "google/protobuf/util/json_util.h"
 #include "substrait/plan.pb.h"
@@ -38,9 +43,11 @@
 #include "duckdb/main/relation/filter_relation.hpp"
 #include "duckdb/main/relation/join_relation.hpp"
 #include "duckdb/main/relation/limit_relation.hpp"
+#include "duckdb/main/relation/materialized_relation.hpp"
 #include "duckdb/main/relation/order_relation.hpp"
 #include "duckdb/main/relation/projection_relation.hpp"
 #include "duckdb/main/relation/setop_relation.hpp"
+#include "duckdb/main/relation/subquery_relation.hpp"
 
 namespace duckdb {
 const std::unordered_map<std::string, std::string> SubstraitToDuckDB::function_names_remap = {
@@ -54,6 +61,25 @@ const case_insensitive_set_t SubstraitToDuckDB::valid_extract_subfields = {
     "year",    "month",       "day",          "decade", "century", "millenium",
     "quarter", "microsecond", "milliseconds", "second", "minute",  "hour"};
 
+const unordered_map<std::string, SubstraitFunctionKind> SubstraitToDuckDB::function_kinds = {
+    {"and", SubstraitFunctionKind::AND},
+    {"or", SubstraitFunctionKind::OR},
+    {"lt", SubstraitFunctionKind::LESS_THAN},
+    {"equal", SubstraitFunctionKind::EQUAL},
+    {"not_equal", SubstraitFunctionKind::NOT_EQUAL},
+    {"lte", SubstraitFunctionKind::LESS_THAN_OR_EQUAL},
+    {"gte", SubstraitFunctionKind::GREATER_THAN_OR_EQUAL},
+    {"gt", SubstraitFunctionKind::GREATER_THAN},
+    {"is_not_null", SubstraitFunctionKind::IS_NOT_NULL},
+    {"is_null", SubstraitFunctionKind::IS_NULL},
+    {"not", SubstraitFunctionKind::NOT},
+    {"is_not_distinct_from", SubstraitFunctionKind::IS_NOT_DISTINCT_FROM},
+    {"is_distinct_from", SubstraitFunctionKind::IS_DISTINCT_FROM},
+    {"between", SubstraitFunctionKind::BETWEEN},
+    {"coalesce", SubstraitFunctionKind::COALESCE},
+    {"index_in", SubstraitFunctionKind::INDEX_IN},
+    {"extract", SubstraitFunctionKind::EXTRACT}};
+
 string SubstraitToDuckDB::RemapFunctionName(const string &function_name) {
 	// Let's first drop any extension id
 	string name;
@@ -82,25 +108,134 @@ string SubstraitToDuckDB::RemoveExtension(const string &function_name) {
 	return name;
 }
 
-SubstraitToDuckDB::SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, const string &serialized, bool json,
-                                     bool acquire_lock_p)
-    : context(context_p), acquire_lock(acquire_lock_p) {
+//! Maximum nesting of messages when parsing a binary plan
+static constexpr int PLAN_RECURSION_LIMIT = 5000;
+//! Upper bound of the messages a relation or expression nests in a binary plan (e.g. Expression, ScalarFunction,
+//! FunctionArgument), used to raise the recursion limit when deeper plans are allowed
+static constexpr idx_t MESSAGES_PER_PLAN_LEVEL = 4;
+//! Maximum size of the blocks the arena of a parsed plan allocates
+static constexpr size_t PLAN_ARENA_MAX_BLOCK_SIZE = 1 << 20;
+//! Literal-only virtual tables with at least this many rows are decoded into a collection instead of being
+//! bound as one expression per value
+static constexpr int VIRTUAL_TABLE_COLLECTION_THRESHOLD = STANDARD_VECTOR_SIZE;
+
+//! Every relation binds its whole subtree when it is constructed, which makes transforming a plan quadratic in its
+//! depth. While deferring, only leaf relations (whose binding does not depend on a subtree) are bound; the
+//! transformer turns deferring off once the tree is complete, so the root binds the whole plan once.
+class DeferredBindContextWrapper : public RelationContextWrapper {
+public:
+	explicit DeferredBindContextWrapper(const shared_ptr<ClientContext> &context) : RelationContextWrapper(context) {
+	}
+
+	void TryBindRelation(Relation &relation, vector<ColumnDefinition> &columns) override {
+		if (defer_binding && !IsLeaf(relation)) {
+			return;
+		}
+		RelationContextWrapper::TryBindRelation(relation, columns);
+	}
+
+	static bool IsLeaf(const Relation &relation) {
+		switch (relation.type) {
+		case RelationType::TABLE_RELATION:
+		case RelationType::VIEW_RELATION:
+		case RelationType::VALUE_LIST_RELATION:
+		case RelationType::TABLE_FUNCTION_RELATION:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool defer_binding = true;
+};
+
+shared_ptr<substrait::Plan> SubstraitToDuckDB::ParsePlan(const string &serialized, bool json,
+                                                          idx_t max_plan_depth) {
+	return ParsePlan(serialized.data(), serialized.size(), json, max_plan_depth);
+}
+
+shared_ptr<substrait::Plan> SubstraitToDuckDB::ParsePlan(const char *data, idx_t size, bool json,
+                                                          idx_t max_plan_depth) {
+	// Allocate the plan and all of its messages on an arena, so they are freed at once. The first block is sized
+	// after the serialized plan, to avoid growing through many small blocks for large plans.
+	google::protobuf::ArenaOptions options;
+	options.start_block_size = MinValue<size_t>(MaxValue<size_t>(size, options.start_block_size),
+	                                            PLAN_ARENA_MAX_BLOCK_SIZE);
+	options.max_block_size = MaxValue<size_t>(options.max_block_size, options.start_block_size);
+	auto arena = make_shared_ptr<google::protobuf::Arena>(options);
+	auto plan = google::protobuf::Arena::Create<substrait::Plan>(arena.get());
 	if (!json) {
-		if (!plan.ParseFromString(serialized)) {
+		// Parse straight from the caller's buffer
+		google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t *>(data), NumericCast<int>(size));
+		// Every Rel nests a few messages, the default limit of 100 rejects plans of a few dozen operators
+		auto max_levels = MinValue<idx_t>(max_plan_depth, MAX_PLAN_DEPTH_LIMIT);
+		auto recursion_limit = NumericCast<int>(max_levels * MESSAGES_PER_PLAN_LEVEL);
+		stream.SetRecursionLimit(MaxValue<int>(PLAN_RECURSION_LIMIT, recursion_limit));
+		if (!plan->ParseFromCodedStream(&stream) || !stream.ConsumedEntireMessage()) {
 			throw std::runtime_error("Was not possible to convert binary into Substrait plan");
 		}
 	} else {
-		auto status = google::protobuf::util::JsonStringToMessage(serialized, &plan);
+		auto status = google::protobuf::util::JsonStringToMessage({data, size}, plan);
 		if (!status.ok()) {
 			throw std::runtime_error("Was not possible to convert JSON into Substrait plan: " + status.ToString());
 		}
 	}
+	// The returned pointer keeps the arena alive
+	return shared_ptr<substrait::Plan>(arena, plan);
+}
+
+SubstraitConsumerSettings::SubstraitConsumerSettings(ClientContext &context)
+    : in_list_join_threshold(SubstraitToDuckDB::DEFAULT_IN_LIST_JOIN_THRESHOLD),
+      max_plan_depth(GetMaxPlanDepth(context)) {
+	Value threshold;
+	if (context.TryGetCurrentSetting(SubstraitToDuckDB::IN_LIST_JOIN_THRESHOLD_SETTING, threshold) &&
+	    !threshold.IsNull()) {
+		in_list_join_threshold = threshold.GetValue<uint64_t>();
+	}
+}
+
+SubstraitToDuckDB::SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, const string &serialized, bool json,
+                                     bool acquire_lock_p)
+    : SubstraitToDuckDB(context_p, serialized, SubstraitConsumerSettings(*context_p), json, acquire_lock_p) {
+}
+
+SubstraitToDuckDB::SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, const string &serialized,
+                                     const SubstraitConsumerSettings &settings, bool json, bool acquire_lock_p)
+    : SubstraitToDuckDB(context_p, ParsePlan(serialized, json, settings.max_plan_depth), settings,
+                        acquire_lock_p) {
+}
 
-	for (auto &sext : plan.extensions()) {
+SubstraitToDuckDB::SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, shared_ptr<substrait::Plan> plan_p,
+                                     const SubstraitConsumerSettings &settings, bool acquire_lock_p)
+    : context(context_p), plan(std::move(plan_p)), acquire_lock(acquire_lock_p),
+      in_list_join_threshold(settings.in_list_join_threshold), max_plan_depth(settings.max_plan_depth) {
+	if (!acquire_lock) {
+		context_wrapper = make_shared_ptr<DeferredBindContextWrapper>(context);
+	}
+	// Resolve the declared functions once, instead of on every call to them
+	auto dense_anchor_limit = NumericCast<uint64_t>(plan->extensions_size()) * 2 + 16;
+	for (auto &sext : plan->extensions()) {
 		if (!sext.has_extension_function()) {
 			continue;
 		}
-		functions_map[sext.extension_function().function_anchor()] = sext.extension_function().name();
+		auto &extension_function = sext.extension_function();
+		uint64_t anchor = extension_function.function_anchor();
+		SubstraitFunction function;
+		function.name = extension_function.name();
+		function.duckdb_name = RemapFunctionName(function.name);
+		auto kind = function_kinds.find(RemoveExtension(function.name));
+		if (kind != function_kinds.end()) {
+			function.kind = kind->second;
+		}
+		function.declared = true;
+		if (anchor < dense_anchor_limit) {
+			if (anchor >= functions.size()) {
+				functions.resize(anchor + 1);
+			}
+			functions[anchor] = std::move(function);
+		} else {
+			sparse_functions[anchor] = std::move(function);
+		}
 	}
 }
 
@@ -390,12 +525,50 @@ void SubstraitToDuckDB::VerifyCorrectExtractSubfield(const string &subfield) {
 	D_ASSERT(SubstraitToDuckDB::valid_extract_subfields.count(subfield));
 }
 
+unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformConjunctionExpr(const substrait::Expression &sexpr,
+                                                                         SubstraitFunctionKind kind) {
+	// Producers may chain binary calls, e.g. and(and(and(a, b), c), d). The chain is walked with an explicit stack, so
+	// its depth does not turn into recursion depth, and all of its operands become children of one conjunction.
+	vector<unique_ptr<ParsedExpression>> children;
+	vector<const substrait::Expression *> pending {&sexpr};
+	while (!pending.empty()) {
+		auto &expr = *pending.back();
+		pending.pop_back();
+		if (!expr.has_scalar_function() || GetFunction(expr.scalar_function().function_reference()).kind != kind) {
+			children.push_back(TransformExpr(expr));
+			continue;
+		}
+		// Push the arguments in reverse, so they are visited from left to right
+		auto &arguments = expr.scalar_function().arguments();
+		for (auto arg = arguments.rbegin(); arg != arguments.rend(); arg++) {
+			if (arg->has_value()) {
+				pending.push_back(&arg->value());
+			} else if (arg->has_type()) {
+				throw NotImplementedException("Type arguments in Substrait expressions are not supported yet!");
+			}
+		}
+	}
+	auto conjunction_type = kind == SubstraitFunctionKind::AND ? ExpressionType::CONJUNCTION_AND
+	                                                           : ExpressionType::CONJUNCTION_OR;
+	return make_uniq<ConjunctionExpression>(conjunction_type, std::move(children));
+}
+
 unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformScalarFunctionExpr(const substrait::Expression &sexpr) {
-	auto function_name = FindFunction(sexpr.scalar_function().function_reference());
-	function_name = RemoveExtension(function_name);
+	auto &function = GetFunction(sexpr.scalar_function().function_reference());
 	vector<unique_ptr<ParsedExpression>> children;
 	vector<string> enum_expressions;
 	auto &function_arguments = sexpr.scalar_function().arguments();
+	if (function.kind == SubstraitFunctionKind::IS_NOT_NULL && function_arguments.size() == 1 &&
+	    function_arguments[0].has_value()) {
+		// Checked before transforming the arguments, as the list of a compact IN filter can be large
+		auto in_list = TransformIndexInIsNotNull(function_arguments[0].value());
+		if (in_list) {
+			return in_list;
+		}
+	}
+	if (function.kind == SubstraitFunctionKind::AND || function.kind == SubstraitFunctionKind::OR) {
+		return TransformConjunctionExpr(sexpr, function.kind);
+	}
 	for (auto &sarg : function_arguments) {
 		if (sarg.has_value()) {
 			// value expression
@@ -410,21 +583,16 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformScalarFunctionExpr(cons
 			enum_expressions.push_back(enum_str);
 		}
 	}
-	// string compare galore
-	// TODO simplify this
-	if (function_name == "and") {
-		return make_uniq<ConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(children));
-	} else if (function_name == "or") {
-		return make_uniq<ConjunctionExpression>(ExpressionType::CONJUNCTION_OR, std::move(children));
-	} else if (function_name == "lt") {
+	switch (function.kind) {
+	case SubstraitFunctionKind::LESS_THAN:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_LESSTHAN, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "equal") {
+	case SubstraitFunctionKind::EQUAL:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_EQUAL, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "not_equal") {
+	case SubstraitFunctionKind::NOT_EQUAL: {
 		D_ASSERT(children.size() == 2);
 		// FIXME: We do a not_like if we are doing a string comparison
 		// This is due to substrait not supporting !~~
@@ -444,53 +612,68 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformScalarFunctionExpr(cons
 			return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_NOTEQUAL, std::move(children[0]),
 			                                       std::move(children[1]));
 		}
-
-	} else if (function_name == "lte") {
+	}
+	case SubstraitFunctionKind::LESS_THAN_OR_EQUAL:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "gte") {
+	case SubstraitFunctionKind::GREATER_THAN_OR_EQUAL:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "gt") {
+	case SubstraitFunctionKind::GREATER_THAN:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_GREATERTHAN, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "is_not_null") {
+	case SubstraitFunctionKind::IS_NOT_NULL:
 		D_ASSERT(children.size() == 1);
 		return make_uniq<OperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, std::move(children[0]));
-	} else if (function_name == "is_null") {
+	case SubstraitFunctionKind::IS_NULL:
 		D_ASSERT(children.size() == 1);
 		return make_uniq<OperatorExpression>(ExpressionType::OPERATOR_IS_NULL, std::move(children[0]));
-	} else if (function_name == "not") {
+	case SubstraitFunctionKind::NOT:
 		D_ASSERT(children.size() == 1);
 		return make_uniq<OperatorExpression>(ExpressionType::OPERATOR_NOT, std::move(children[0]));
-	} else if (function_name == "is_not_distinct_from") {
+	case SubstraitFunctionKind::IS_NOT_DISTINCT_FROM:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_NOT_DISTINCT_FROM, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "is_distinct_from") {
+	case SubstraitFunctionKind::IS_DISTINCT_FROM:
 		D_ASSERT(children.size() == 2);
 		return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_DISTINCT_FROM, std::move(children[0]),
 		                                       std::move(children[1]));
-	} else if (function_name == "between") {
+	case SubstraitFunctionKind::BETWEEN:
 		D_ASSERT(children.size() == 3);
 		return make_uniq<BetweenExpression>(std::move(children[0]), std::move(children[1]), std::move(children[2]));
-	} else if (function_name == "coalesce") {
+	case SubstraitFunctionKind::COALESCE:
 		// COALESCE is a variadic function that returns the first non-NULL value
 		// Convert to DuckDB's OPERATOR_COALESCE
 		D_ASSERT(children.size() >= 1);
 		return make_uniq<OperatorExpression>(ExpressionType::OPERATOR_COALESCE, std::move(children));
-	} else if (function_name == "extract") {
+	case SubstraitFunctionKind::INDEX_IN: {
+		// index_in returns the 0-based position of its first argument in the list of its second
+		D_ASSERT(children.size() == 2);
+		vector<unique_ptr<ParsedExpression>> position_children;
+		position_children.push_back(std::move(children[1]));
+		position_children.push_back(std::move(children[0]));
+		vector<unique_ptr<ParsedExpression>> index_children;
+		index_children.push_back(make_uniq<FunctionExpression>("list_position", std::move(position_children)));
+		index_children.push_back(make_uniq<ConstantExpression>(Value::INTEGER(1)));
+		return make_uniq<FunctionExpression>("-", std::move(index_children));
+	}
+	case SubstraitFunctionKind::EXTRACT: {
 		D_ASSERT(enum_expressions.size() == 1);
 		auto &subfield = enum_expressions[0];
 		VerifyCorrectExtractSubfield(subfield);
 		auto constant_expression = make_uniq<ConstantExpression>(Value(subfield));
 		children.insert(children.begin(), std::move(constant_expression));
+		break;
+	}
+	case SubstraitFunctionKind::GENERIC:
+		break;
 	}
 
-	return make_uniq<FunctionExpression>(RemapFunctionName(function_name), std::move(children));
+	return make_uniq<FunctionExpression>(function.duckdb_name, std::move(children));
 }
 
 unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformIfThenExpr(const substrait::Expression &sexpr) {
@@ -624,6 +807,16 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformCastExpr(const substrai
 
 unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformInExpr(const substrait::Expression &sexpr) {
 	const auto &substrait_in = sexpr.singular_or_list();
+	vector<const substrait::Expression_Literal *> literal_options;
+	for (auto &option : substrait_in.options()) {
+		if (!option.has_literal()) {
+			break;
+		}
+		literal_options.push_back(&option.literal());
+	}
+	if (literal_options.size() == NumericCast<idx_t>(substrait_in.options_size())) {
+		return TransformInList(substrait_in.value(), literal_options);
+	}
 
 	vector<unique_ptr<ParsedExpression>> values;
 	values.emplace_back(TransformExpr(substrait_in.value()));
@@ -635,6 +828,100 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformInExpr(const substrait:
 	return make_uniq<OperatorExpression>(ExpressionType::COMPARE_IN, std::move(values));
 }
 
+unique_ptr<ParsedExpression>
+SubstraitToDuckDB::TransformInList(const substrait::Expression &value,
+                                   const vector<const substrait::Expression_Literal *> &options) {
+	if (in_list_join_threshold > 0 && options.size() >= in_list_join_threshold) {
+		auto in_join = TransformInListJoin(value, options);
+		if (in_join) {
+			return in_join;
+		}
+	}
+	vector<unique_ptr<ParsedExpression>> values;
+	values.emplace_back(TransformExpr(value));
+	for (auto option : options) {
+		values.emplace_back(make_uniq<ConstantExpression>(TransformLiteralToValue(*option)));
+	}
+	return make_uniq<OperatorExpression>(ExpressionType::COMPARE_IN, std::move(values));
+}
+
+//! Transforms a large IN list into "value = ANY (SELECT * FROM options)" over a collection holding the options.
+//! DuckDB plans it as a mark join probing a hash table, which the filter pushdown turns into a semi join when the
+//! IN list is a filter condition, instead of binding and comparing against every option. Returns nullptr if the
+//! options differ in type, in which case they have to be bound as expressions to unify their types.
+unique_ptr<ParsedExpression>
+SubstraitToDuckDB::TransformInListJoin(const substrait::Expression &value,
+                                       const vector<const substrait::Expression_Literal *> &options) {
+	// The type of the options is that of the first non-NULL literal
+	LogicalType type(LogicalTypeId::SQLNULL);
+	for (auto option : options) {
+		if (!option->has_null()) {
+			type = TransformLiteralToValue(*option).type();
+			break;
+		}
+	}
+	if (type.id() == LogicalTypeId::SQLNULL) {
+		return nullptr;
+	}
+
+	vector<LogicalType> types {type};
+	auto collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(*context), types);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(*context), types);
+	for (auto option : options) {
+		// NULL options are kept, they make a comparison that matches no option NULL instead of false, as in IN lists
+		auto option_value = TransformLiteralToValue(*option);
+		if (!option_value.IsNull() && option_value.type() != type) {
+			return nullptr;
+		}
+		chunk.SetValue(0, chunk.size(), option_value);
+		chunk.SetCardinality(chunk.size() + 1);
+		if (chunk.size() == STANDARD_VECTOR_SIZE) {
+			collection->Append(chunk);
+			chunk.Reset();
+		}
+	}
+	if (chunk.size() > 0) {
+		collection->Append(chunk);
+	}
+
+	auto options_rel = make_shared_ptr<MaterializedRelation>(context, std::move(collection), vector<string> {"option"});
+	auto select = make_uniq<SelectStatement>();
+	select->node = options_rel->GetQueryNode();
+	auto subquery = make_uniq<SubqueryExpression>();
+	subquery->subquery_type = SubqueryType::ANY;
+	subquery->comparison_type = ExpressionType::COMPARE_EQUAL;
+	subquery->child = TransformExpr(value);
+	subquery->subquery = std::move(select);
+	return std::move(subquery);
+}
+
+//! Transforms "index_in(value, [options]) IS NOT NULL", the compact form of IN filters on a list literal, into
+//! "value IS NOT NULL AND value IN (options)". Returns nullptr if the expression is of any other form.
+unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformIndexInIsNotNull(const substrait::Expression &sexpr) {
+	if (!sexpr.has_scalar_function() ||
+	    GetFunction(sexpr.scalar_function().function_reference()).kind != SubstraitFunctionKind::INDEX_IN) {
+		return nullptr;
+	}
+	auto &arguments = sexpr.scalar_function().arguments();
+	if (arguments.size() != 2 || !arguments[0].has_value() || !arguments[1].has_value() ||
+	    !arguments[1].value().has_literal() || !arguments[1].value().literal().has_list()) {
+		return nullptr;
+	}
+	vector<const substrait::Expression_Literal *> options;
+	for (auto &option : arguments[1].value().literal().list().values()) {
+		if (option.has_null()) {
+			// A NULL option makes IN lists NULL instead of false, unlike index_in
+			return nullptr;
+		}
+		options.push_back(&option);
+	}
+	auto &value = arguments[0].value();
+	auto is_not_null = make_uniq<OperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, TransformExpr(value));
+	return make_uniq<ConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(is_not_null),
+	                                        TransformInList(value, options));
+}
+
 unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformNested(const substrait::Expression &sexpr,
                                                                 RootNameIterator *iterator) {
 	auto &nested_expression = sexpr.nested();
@@ -678,6 +965,7 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformNested(const substrait:
 
 unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformExpr(const substrait::Expression &sexpr,
                                                               RootNameIterator *iterator) {
+	PlanDepthGuard depth_guard(plan_depth, max_plan_depth);
 	if (iterator) {
 		iterator->Next();
 	}
@@ -704,11 +992,19 @@ unique_ptr<ParsedExpression> SubstraitToDuckDB::TransformExpr(const substrait::E
 	}
 }
 
-string SubstraitToDuckDB::FindFunction(uint64_t id) {
-	if (functions_map.find(id) == functions_map.end()) {
+const SubstraitFunction &SubstraitToDuckDB::GetFunction(uint64_t id) const {
+	if (id < functions.size() && functions[id].declared) {
+		return functions[id];
+	}
+	auto entry = sparse_functions.find(id);
+	if (entry == sparse_functions.end()) {
 		throw NotImplementedException("Could not find aggregate function %s", to_string(id));
 	}
-	return functions_map[id];
+	return entry->second;
+}
+
+const string &SubstraitToDuckDB::FindFunction(uint64_t id) const {
+	return GetFunction(id).name;
 }
 
 OrderByNode SubstraitToDuckDB::TransformOrder(const substrait::SortField &sordf) {
@@ -896,7 +1192,7 @@ SubstraitToDuckDB::TransformProjectOp(const substrait::Rel &sop,
 	}
 	if (!hasZeroColumnVirtualTable) {
 		input_rel = TransformOp(input);
-		num_input_columns = input_rel->Columns().size();
+		num_input_columns = GetColumnCount(*input_rel);
 	}
 
 	auto mapping = GetOutputMapping(sop);
@@ -1030,7 +1326,6 @@ unique_ptr<TableDescription> TableInfo(ClientContext &context, const string &sch
 shared_ptr<Relation> SubstraitToDuckDB::TransformReadOp(const substrait::Rel &sop) {
 	auto &sget = sop.read();
 	shared_ptr<Relation> scan;
-	auto context_wrapper = make_shared_ptr<RelationContextWrapper>(context);
 	if (sget.has_named_table()) {
 		auto &named_table = sget.named_table();
 		auto names_size = named_table.names_size();
@@ -1104,7 +1399,12 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformReadOp(const substrait::Rel &so
 	} else if (sget.has_virtual_table()) {
 		// We need to handle a virtual table as a LogicalExpressionGet
 		if (!sget.virtual_table().expressions().empty()) {
-			scan = GetValuesExpression(sget.virtual_table().expressions());
+			if (sget.virtual_table().expressions_size() >= VIRTUAL_TABLE_COLLECTION_THRESHOLD) {
+				scan = GetValuesCollection(sget.virtual_table().expressions());
+			}
+			if (!scan) {
+				scan = GetValuesExpression(sget.virtual_table().expressions());
+			}
 		} else if (sget.has_base_schema() && sget.base_schema().names_size() > 0 && sget.base_schema().struct_().types_size() > 0) {
 			// Empty virtual table represents an empty result (EMPTY_RESULT operator)
 			// Extract schema from base_schema
@@ -1243,7 +1543,6 @@ shared_ptr<Relation> SubstraitToDuckDB::GetValueRelationWithSingleBoolColumn() {
 	if (acquire_lock) {
 		scan = make_shared_ptr<ValueRelation>(context, std::move(expressions), column_names);
 	} else {
-		auto context_wrapper = make_shared_ptr<RelationContextWrapper>(context);
 		scan = make_shared_ptr<ValueRelation>(context_wrapper, std::move(expressions), column_names);
 	}
 	return scan;
@@ -1264,12 +1563,230 @@ shared_ptr<Relation> SubstraitToDuckDB::GetValuesExpression(
 	if (acquire_lock) {
 		scan = make_shared_ptr<ValueRelation>(context, std::move(expressions), column_names);
 	} else {
-		auto context_wrapper = make_shared_ptr<RelationContextWrapper>(context);
 		scan = make_shared_ptr<ValueRelation>(context_wrapper, std::move(expressions), column_names);
 	}
 	return scan;
 }
 
+//! Returns the type of the column a literal is decoded into by DecodeLiteralColumn, or INVALID if the literal has to be
+//! decoded through a Value
+static LogicalType GetDirectLiteralType(const substrait::Expression_Literal &literal) {
+	switch (literal.literal_type_case()) {
+	case substrait::Expression_Literal::LiteralTypeCase::kBoolean:
+		return LogicalType::BOOLEAN;
+	case substrait::Expression_Literal::LiteralTypeCase::kI8:
+		return LogicalType::TINYINT;
+	case substrait::Expression_Literal::LiteralTypeCase::kI16:
+		return LogicalType::SMALLINT;
+	case substrait::Expression_Literal::LiteralTypeCase::kI32:
+		return LogicalType::INTEGER;
+	case substrait::Expression_Literal::LiteralTypeCase::kI64:
+		return LogicalType::BIGINT;
+	case substrait::Expression_Literal::LiteralTypeCase::kFp32:
+		return LogicalType::FLOAT;
+	case substrait::Expression_Literal::LiteralTypeCase::kFp64:
+		return LogicalType::DOUBLE;
+	case substrait::Expression_Literal::LiteralTypeCase::kString:
+	case substrait::Expression_Literal::LiteralTypeCase::kVarChar:
+	case substrait::Expression_Literal::LiteralTypeCase::kFixedChar:
+		return LogicalType::VARCHAR;
+	case substrait::Expression_Literal::LiteralTypeCase::kBinary:
+	case substrait::Expression_Literal::LiteralTypeCase::kFixedBinary:
+		return LogicalType::BLOB;
+	case substrait::Expression_Literal::LiteralTypeCase::kDate:
+		return LogicalType::DATE;
+	case substrait::Expression_Literal::LiteralTypeCase::kPrecisionTime:
+		return LogicalType::TIME;
+	case substrait::Expression_Literal::LiteralTypeCase::kPrecisionTimestamp:
+		return LogicalType::TIMESTAMP;
+	case substrait::Expression_Literal::LiteralTypeCase::kPrecisionTimestampTz:
+		return LogicalType::TIMESTAMP_TZ;
+	default:
+		return LogicalType::INVALID;
+	}
+}
+
+static const string &GetStringLiteral(const substrait::Expression_Literal &literal) {
+	switch (literal.literal_type_case()) {
+	case substrait::Expression_Literal::LiteralTypeCase::kString:
+		return literal.string();
+	case substrait::Expression_Literal::LiteralTypeCase::kVarChar:
+		return literal.var_char().value();
+	case substrait::Expression_Literal::LiteralTypeCase::kFixedChar:
+		return literal.fixed_char();
+	case substrait::Expression_Literal::LiteralTypeCase::kBinary:
+		return literal.binary();
+	default:
+		return literal.fixed_binary();
+	}
+}
+
+//! Writes the literals of a column of count rows starting at offset into the data and validity of result
+template <class T, class OP>
+static void DecodeLiteralColumn(const google::protobuf::RepeatedPtrField<substrait::Expression_Nested_Struct> &rows,
+                                int col_idx, idx_t offset, idx_t count, Vector &result, OP &&decode) {
+	auto result_data = FlatVector::GetData<T>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		auto &literal = rows.Get(NumericCast<int>(offset + row_idx)).fields(col_idx).literal();
+		if (literal.has_null()) {
+			result_validity.SetInvalid(row_idx);
+			continue;
+		}
+		result_data[row_idx] = decode(literal);
+	}
+}
+
+//! Decodes a virtual table whose values are all literals straight into a collection, without creating and binding
+//! an expression per value. Literals of the common scalar types are written into the vectors of their column
+//! directly, the others go through a Value. Returns nullptr if the table holds anything but literals, or if the
+//! literals of a column differ in type, in which case the values have to be bound as expressions to unify their types.
+shared_ptr<Relation> SubstraitToDuckDB::GetValuesCollection(
+    const google::protobuf::RepeatedPtrField<substrait::Expression_Nested_Struct> &expression_rows) {
+	// The column types are those of the first non-NULL literal of every column. Columns of directly decoded
+	// literals are checked here, the others when their Values are created.
+	auto column_count = expression_rows.Get(0).fields_size();
+	vector<LogicalType> types(NumericCast<idx_t>(column_count), LogicalType::SQLNULL);
+	vector<bool> direct(NumericCast<idx_t>(column_count), false);
+	for (auto &row : expression_rows) {
+		if (row.fields_size() != column_count) {
+			return nullptr;
+		}
+		for (int col_idx = 0; col_idx < column_count; col_idx++) {
+			auto &field = row.fields(col_idx);
+			if (!field.has_literal()) {
+				return nullptr;
+			}
+			auto &literal = field.literal();
+			if (literal.has_null()) {
+				continue;
+			}
+			if (types[col_idx].id() == LogicalTypeId::SQLNULL) {
+				auto direct_type = GetDirectLiteralType(literal);
+				direct[col_idx] = direct_type.id() != LogicalTypeId::INVALID;
+				types[col_idx] = direct[col_idx] ? direct_type : TransformLiteralToValue(literal).type();
+			} else if (direct[col_idx] && GetDirectLiteralType(literal) != types[col_idx]) {
+				return nullptr;
+			}
+		}
+	}
+	for (auto &type : types) {
+		if (type.id() == LogicalTypeId::SQLNULL) {
+			return nullptr;
+		}
+	}
+
+	auto &rows = expression_rows;
+	auto row_count = NumericCast<idx_t>(expression_rows.size());
+	auto collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(*context), types);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(*context), types);
+	for (idx_t offset = 0; offset < row_count; offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_count - offset);
+		for (int col_idx = 0; col_idx < column_count; col_idx++) {
+			auto &result = chunk.data[NumericCast<idx_t>(col_idx)];
+			if (!direct[col_idx]) {
+				for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+					auto &row = rows.Get(NumericCast<int>(offset + row_idx));
+					auto value = TransformLiteralToValue(row.fields(col_idx).literal());
+					if (!value.IsNull() && value.type() != types[col_idx]) {
+						return nullptr;
+					}
+					result.SetValue(row_idx, value);
+				}
+				continue;
+			}
+			switch (types[col_idx].id()) {
+			case LogicalTypeId::BOOLEAN:
+				DecodeLiteralColumn<bool>(rows, col_idx, offset, count, result,
+				                          [](const substrait::Expression_Literal &literal) {
+					                          return literal.boolean();
+				                          });
+				break;
+			case LogicalTypeId::TINYINT:
+				DecodeLiteralColumn<int8_t>(rows, col_idx, offset, count, result,
+				                            [](const substrait::Expression_Literal &literal) {
+					                            return static_cast<int8_t>(literal.i8());
+				                            });
+				break;
+			case LogicalTypeId::SMALLINT:
+				DecodeLiteralColumn<int16_t>(rows, col_idx, offset, count, result,
+				                             [](const substrait::Expression_Literal &literal) {
+					                             return static_cast<int16_t>(literal.i16());
+				                             });
+				break;
+			case LogicalTypeId::INTEGER:
+				DecodeLiteralColumn<int32_t>(rows, col_idx, offset, count, result,
+				                             [](const substrait::Expression_Literal &literal) { return literal.i32(); });
+				break;
+			case LogicalTypeId::BIGINT:
+				DecodeLiteralColumn<int64_t>(rows, col_idx, offset, count, result,
+				                             [](const substrait::Expression_Literal &literal) { return literal.i64(); });
+				break;
+			case LogicalTypeId::FLOAT:
+				DecodeLiteralColumn<float>(rows, col_idx, offset, count, result,
+				                           [](const substrait::Expression_Literal &literal) { return literal.fp32(); });
+				break;
+			case LogicalTypeId::DOUBLE:
+				DecodeLiteralColumn<double>(rows, col_idx, offset, count, result,
+				                            [](const substrait::Expression_Literal &literal) { return literal.fp64(); });
+				break;
+			case LogicalTypeId::VARCHAR:
+			case LogicalTypeId::BLOB:
+				DecodeLiteralColumn<string_t>(rows, col_idx, offset, count, result,
+				                              [&](const substrait::Expression_Literal &literal) {
+					                              return StringVector::AddStringOrBlob(result, GetStringLiteral(literal));
+				                              });
+				break;
+			case LogicalTypeId::DATE:
+				DecodeLiteralColumn<date_t>(rows, col_idx, offset, count, result,
+				                            [](const substrait::Expression_Literal &literal) {
+					                            return date_t(literal.date());
+				                            });
+				break;
+			case LogicalTypeId::TIME:
+				DecodeLiteralColumn<dtime_t>(rows, col_idx, offset, count, result,
+				                             [](const substrait::Expression_Literal &literal) {
+					                             return dtime_t(literal.precision_time().value());
+				                             });
+				break;
+			case LogicalTypeId::TIMESTAMP:
+				DecodeLiteralColumn<timestamp_t>(rows, col_idx, offset, count, result,
+				                                 [](const substrait::Expression_Literal &literal) {
+					                                 auto &timestamp = literal.precision_timestamp();
+					                                 return timestamp_t(
+					                                     ScaleToMicros(timestamp.value(), timestamp.precision()));
+				                                 });
+				break;
+			case LogicalTypeId::TIMESTAMP_TZ:
+				DecodeLiteralColumn<timestamp_tz_t>(rows, col_idx, offset, count, result,
+				                                    [](const substrait::Expression_Literal &literal) {
+					                                    auto &timestamp = literal.precision_timestamp_tz();
+					                                    return timestamp_tz_t(
+					                                        ScaleToMicros(timestamp.value(), timestamp.precision()));
+				                                    });
+				break;
+			default:
+				throw InternalException("Unexpected type of directly decoded literals: %s", types[col_idx].ToString());
+			}
+		}
+		chunk.SetCardinality(count);
+		collection->Append(chunk);
+		chunk.Reset();
+	}
+
+	vector<string> column_names;
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		column_names.push_back("col" + to_string(col_idx));
+	}
+	shared_ptr<Relation> scan = make_shared_ptr<MaterializedRelation>(context, std::move(collection), column_names);
+	if (!acquire_lock) {
+		// The relations created on top of this one take over its context, which defers their binding
+		scan->context = context_wrapper;
+	}
+	return scan;
+}
+
 shared_ptr<Relation> SubstraitToDuckDB::TransformSortOp(const substrait::Rel &sop,
                                                         const google::protobuf::RepeatedPtrField<std::string> *names) {
 	vector<OrderByNode> order_nodes;
@@ -1288,7 +1805,7 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformWindowOp(const substrait::Rel &
 	vector<string> aliases;
 	
 	// First, add all input columns to preserve them in the output
-	auto num_input_columns = input_rel->Columns().size();
+	auto num_input_columns = GetColumnCount(*input_rel);
 	for (size_t i = 0; i < num_input_columns; i++) {
 		expressions.push_back(make_uniq<PositionalReferenceExpression>(i + 1));
 		aliases.push_back(""); // Empty alias, DuckDB will use the original column name
@@ -1466,6 +1983,8 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformWriteOp(const substrait::Rel &s
 		}
 	}
 	auto input = TransformOp(swrite.input());
+	// A write is the root of the plan, its relation is bound right away
+	EndDeferredBinding();
 	switch (swrite.op()) {
 	case substrait::WriteRel::WriteOp::WriteRel_WriteOp_WRITE_OP_CTAS:
 		return input->CreateRel(schema_name, table_name);
@@ -1501,8 +2020,79 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformReferenceOp(const substrait::Re
 	return cte;
 }
 
+idx_t SubstraitToDuckDB::GetColumnCount(Relation &relation) {
+	if (DeferredBindContextWrapper::IsLeaf(relation) || !relation.Columns().empty()) {
+		return relation.Columns().size();
+	}
+	auto entry = column_counts.find(&relation);
+	if (entry != column_counts.end()) {
+		return entry->second;
+	}
+	idx_t count;
+	switch (relation.type) {
+	case RelationType::PROJECTION_RELATION:
+		count = relation.Cast<ProjectionRelation>().expressions.size();
+		break;
+	case RelationType::AGGREGATE_RELATION:
+		count = relation.Cast<AggregateRelation>().expressions.size();
+		break;
+	case RelationType::FILTER_RELATION:
+		count = GetColumnCount(*relation.Cast<FilterRelation>().child);
+		break;
+	case RelationType::LIMIT_RELATION:
+		count = GetColumnCount(*relation.Cast<LimitRelation>().child);
+		break;
+	case RelationType::ORDER_RELATION:
+		count = GetColumnCount(*relation.Cast<OrderRelation>().child);
+		break;
+	case RelationType::SUBQUERY_RELATION:
+		count = GetColumnCount(*relation.Cast<SubqueryRelation>().child);
+		break;
+	case RelationType::SET_OPERATION_RELATION:
+		count = GetColumnCount(*relation.Cast<SetOpRelation>().left);
+		break;
+	case RelationType::CROSS_PRODUCT_RELATION: {
+		auto &cross = relation.Cast<CrossProductRelation>();
+		count = GetColumnCount(*cross.left) + GetColumnCount(*cross.right);
+		break;
+	}
+	case RelationType::JOIN_RELATION: {
+		auto &join = relation.Cast<JoinRelation>();
+		switch (join.join_type) {
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+			count = GetColumnCount(*join.left);
+			break;
+		case JoinType::RIGHT_SEMI:
+		case JoinType::RIGHT_ANTI:
+			count = GetColumnCount(*join.right);
+			break;
+		case JoinType::MARK:
+			count = GetColumnCount(*join.left) + 1;
+			break;
+		default:
+			count = GetColumnCount(*join.left) + GetColumnCount(*join.right);
+			break;
+		}
+		break;
+	}
+	default:
+		throw InternalException("Cannot determine the column count of relation type %s",
+		                        RelationTypeToString(relation.type));
+	}
+	column_counts[&relation] = count;
+	return count;
+}
+
+void SubstraitToDuckDB::EndDeferredBinding() {
+	if (context_wrapper) {
+		context_wrapper->defer_binding = false;
+	}
+}
+
 shared_ptr<Relation> SubstraitToDuckDB::TransformOp(const substrait::Rel &sop,
                                                     const google::protobuf::RepeatedPtrField<std::string> *names) {
+	PlanDepthGuard depth_guard(plan_depth, max_plan_depth);
 	switch (sop.rel_type_case()) {
 	case substrait::Rel::RelTypeCase::kJoin:
 		return TransformJoinOp(sop);
@@ -1571,9 +2161,15 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformRootOp(const substrait::RelRoot
 	vector<unique_ptr<ParsedExpression>> expressions;
 	int id = 1;
 	auto child = TransformOp(sop.input(), &column_names);
+	EndDeferredBinding();
 	auto first_projection_or_table = GetProjection(*child);
 	if (first_projection_or_table) {
-		vector<ColumnDefinition> *column_definitions = &first_projection_or_table->Cast<ProjectionRelation>().columns;
+		auto &projection = first_projection_or_table->Cast<ProjectionRelation>();
+		if (projection.columns.empty()) {
+			// The projection was created while binding was deferred
+			projection.context->TryBindRelation(projection, projection.columns);
+		}
+		vector<ColumnDefinition> *column_definitions = &projection.columns;
 		int32_t i = 0;
 		if (column_definitions->size() > column_names.size()) {
 			throw InvalidInputException("Number of column names less than number of column definitions");
@@ -1608,17 +2204,17 @@ shared_ptr<Relation> SubstraitToDuckDB::TransformRootOp(const substrait::RelRoot
 }
 
 shared_ptr<Relation> SubstraitToDuckDB::TransformPlan() {
-	if (plan.relations().empty()) {
+	if (plan->relations().empty()) {
 		throw InvalidInputException("Substrait Plan does not have a SELECT statement");
 	}
 	ctes.clear();
-	auto size = plan.relations().size();
+	auto size = plan->relations().size();
 	// The last relation is the root.  Others could be CTEs.
 	for (auto i = 0; i < size - 1; i++) {
-		auto cte = TransformOp(plan.relations(i).rel());
+		auto cte = TransformOp(plan->relations(i).rel());
 		ctes.push_back(cte);
 	}
-	return TransformRootOp(plan.relations(size - 1).root());
+	return TransformRootOp(plan->relations(size - 1).root());
 }
 
 } // namespace duckdb
@@ -40,48 +40,35 @@ public:
 	string extension_path;
 };
 
-struct HashSubstraitFunctions {
-	size_t operator()(SubstraitCustomFunction const &custom_function) const noexcept {
-		// Hash Name
-		auto hash_name = Hash(custom_function.name.c_str());
-		// Hash Input Types
-		auto &i_types = custom_function.arg_types;
-		auto hash_type = Hash(i_types[0].c_str());
-		for (idx_t i = 1; i < i_types.size(); i++) {
-			hash_type = CombineHash(hash_type, Hash(i_types[i].c_str()));
-		}
-		// Combine name and inputs
-		return CombineHash(hash_name, hash_type);
-	}
-};
+//! A declared argument type of a function signature: a substrait::Type::KindCase, or one of the markers below
+typedef int32_t SubstraitTypeKind;
+//! An `any`/`any1` argument, matching any of the kinds in IsWildcardKind()
+static constexpr SubstraitTypeKind SUBSTRAIT_ANY_KIND = -1;
+//! An argument type the producer never emits (user-defined types, func<...> arguments)
+static constexpr SubstraitTypeKind SUBSTRAIT_UNKNOWN_KIND = -2;
+static constexpr idx_t SUBSTRAIT_MAX_SIGNATURE_ARGS = 8;
 
-struct HashSubstraitFunctionsName {
-	size_t operator()(SubstraitCustomFunction const &custom_function) const noexcept {
-		// Hash Name
-		return Hash(custom_function.name.c_str());
-	}
+//! A function signature declared by one of the Substrait extension YAMLs
+struct SubstraitFunctionSignature {
+	const char *name;
+	const char *urn;
+	uint8_t arg_count;
+	SubstraitTypeKind arg_kinds[SUBSTRAIT_MAX_SIGNATURE_ARGS];
+	//! The signature takes any number of arguments of its single argument kind
+	bool variadic;
 };
 
+//! Resolves functions against the signature table generated into custom_extensions_generated.cpp. The table is
+//! constant-initialized and sorted by name, so a lookup is a binary search over the names followed by a scan of that
+//! function's overloads, matching wildcard and variadic arguments as it goes.
 class SubstraitCustomFunctions {
 public:
-	SubstraitCustomFunctions();
 	SubstraitFunctionExtensions Get(const string &name, const vector<substrait::Type> &types) const;
 	static vector<string> GetTypes(const vector<substrait::Type> &types);
-	void Initialize();
 
 private:
-	// For Regular Functions
-	std::unordered_map<SubstraitCustomFunction, SubstraitFunctionExtensions, HashSubstraitFunctions> custom_functions;
-	// For * Functions
-	std::unordered_map<SubstraitCustomFunction, SubstraitFunctionExtensions, HashSubstraitFunctionsName>
-	    any_arg_functions;
-	// For ? Functions
-	// When we have an argument ending with ? it means this argument can repeat many times
-	std::unordered_map<SubstraitCustomFunction, SubstraitFunctionExtensions, HashSubstraitFunctions> many_arg_functions;
-
-	void InsertCustomFunction(string name_p, vector<string> types_p, string file_path);
-	void InsertAllFunctions(const vector<vector<string>> &all_types, vector<idx_t> &indices, int depth, string &name_p,
-	                        string &file_path);
+	static const SubstraitFunctionSignature *SignaturesBegin();
+	static const SubstraitFunctionSignature *SignaturesEnd();
 };
 
 } // namespace duckdb
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "substrait/plan.pb.h"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/common/shared_ptr.hpp"
+#include "plan_depth_guard.hpp"
 
 namespace duckdb {
 
@@ -52,13 +53,74 @@ struct RootNameIterator {
 	int iterator = 0;
 };
 
+class DeferredBindContextWrapper;
+
+//! Scalar functions that are not transformed into a plain DuckDB function call
+enum class SubstraitFunctionKind : uint8_t {
+	GENERIC,
+	AND,
+	OR,
+	LESS_THAN,
+	EQUAL,
+	NOT_EQUAL,
+	LESS_THAN_OR_EQUAL,
+	GREATER_THAN_OR_EQUAL,
+	GREATER_THAN,
+	IS_NOT_NULL,
+	IS_NULL,
+	NOT,
+	IS_NOT_DISTINCT_FROM,
+	IS_DISTINCT_FROM,
+	BETWEEN,
+	COALESCE,
+	INDEX_IN,
+	EXTRACT
+};
+
+//! A function declared in the extensions of a plan, resolved once when the plan is loaded
+struct SubstraitFunction {
+	//! The name of the function, including its signature suffix (e.g., "add:i32_i32")
+	string name;
+	//! The name of the DuckDB function it is transformed into
+	string duckdb_name;
+	SubstraitFunctionKind kind = SubstraitFunctionKind::GENERIC;
+	//! Whether a function with this anchor was declared
+	bool declared = false;
+};
+
+//! Settings that shape how a plan is consumed. Plans are usually transformed on a connection of their own, so these
+//! are read from the connection that consumes the plan instead.
+struct SubstraitConsumerSettings {
+	explicit SubstraitConsumerSettings(ClientContext &context);
+
+	//! IN lists with at least this many literal options are probed through a hash join, 0 disables this
+	idx_t in_list_join_threshold;
+	//! How deep relations and expressions may nest, at most MAX_PLAN_DEPTH_LIMIT
+	idx_t max_plan_depth;
+};
+
 class SubstraitToDuckDB {
 public:
+	//! Transforms a serialized plan with the settings of the given context
 	SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, const string &serialized, bool json = false,
 	                  bool acquire_lock = false);
+	SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, const string &serialized,
+	                  const SubstraitConsumerSettings &settings, bool json = false, bool acquire_lock = false);
+	SubstraitToDuckDB(shared_ptr<ClientContext> &context_p, shared_ptr<substrait::Plan> plan_p,
+	                  const SubstraitConsumerSettings &settings, bool acquire_lock = false);
+	//! Parses a binary or JSON serialized Substrait Plan, max_plan_depth raises how deep binary plans may nest
+	static shared_ptr<substrait::Plan> ParsePlan(const string &serialized, bool json = false,
+	                                             idx_t max_plan_depth = DEFAULT_MAX_PLAN_DEPTH);
+	//! Parses a binary or JSON serialized Substrait Plan from a buffer, without copying it
+	static shared_ptr<substrait::Plan> ParsePlan(const char *data, idx_t size, bool json = false,
+	                                             idx_t max_plan_depth = DEFAULT_MAX_PLAN_DEPTH);
 	//! Transforms Substrait Plan to DuckDB Relation
 	shared_ptr<Relation> TransformPlan();
 
+	//! Setting holding the number of options from which IN lists are probed through a hash join
+	static constexpr const char *IN_LIST_JOIN_THRESHOLD_SETTING = "substrait_in_list_join_threshold";
+	static constexpr idx_t DEFAULT_IN_LIST_JOIN_THRESHOLD = 1024;
+
 private:
 	//! Transforms Substrait Plan Root To a DuckDB Relation
 	shared_ptr<Relation> TransformRootOp(const substrait::RelRoot &sop);
@@ -78,6 +140,8 @@ private:
 	shared_ptr<Relation> GetValueRelationWithSingleBoolColumn();
 	shared_ptr<Relation>
 	GetValuesExpression(const google::protobuf::RepeatedPtrField<substrait::Expression_Nested_Struct> &expression_rows);
+	shared_ptr<Relation>
+	GetValuesCollection(const google::protobuf::RepeatedPtrField<substrait::Expression_Nested_Struct> &expression_rows);
 	shared_ptr<Relation> TransformSortOp(const substrait::Rel &sop,
 	                                     const google::protobuf::RepeatedPtrField<std::string> *names = nullptr);
 	shared_ptr<Relation> TransformSetOp(const substrait::Rel &sop,
@@ -91,9 +155,16 @@ private:
 	static unique_ptr<ParsedExpression> TransformLiteralExpr(const substrait::Expression &sexpr);
 	static unique_ptr<ParsedExpression> TransformSelectionExpr(const substrait::Expression &sexpr);
 	unique_ptr<ParsedExpression> TransformScalarFunctionExpr(const substrait::Expression &sexpr);
+	//! Transforms an and/or call, flattening nested calls of the same function into one ConjunctionExpression
+	unique_ptr<ParsedExpression> TransformConjunctionExpr(const substrait::Expression &sexpr, SubstraitFunctionKind kind);
 	unique_ptr<ParsedExpression> TransformIfThenExpr(const substrait::Expression &sexpr);
 	unique_ptr<ParsedExpression> TransformCastExpr(const substrait::Expression &sexpr);
 	unique_ptr<ParsedExpression> TransformInExpr(const substrait::Expression &sexpr);
+	unique_ptr<ParsedExpression> TransformInList(const substrait::Expression &value,
+	                                             const vector<const substrait::Expression_Literal *> &options);
+	unique_ptr<ParsedExpression> TransformInListJoin(const substrait::Expression &value,
+	                                                 const vector<const substrait::Expression_Literal *> &options);
+	unique_ptr<ParsedExpression> TransformIndexInIsNotNull(const substrait::Expression &sexpr);
 	unique_ptr<ParsedExpression> TransformNested(const substrait::Expression &sexpr,
 	                                             RootNameIterator *iterator = nullptr);
 
@@ -101,25 +172,44 @@ private:
 	static string RemapFunctionName(const string &function_name);
 	static string RemoveExtension(const string &function_name);
 	static LogicalType SubstraitToDuckType(const substrait::Type &s_type);
-	//! Looks up for aggregation function in functions_map
-	string FindFunction(uint64_t id);
+	//! Looks up the function declared with the given anchor
+	const SubstraitFunction &GetFunction(uint64_t id) const;
+	//! Looks up the name of the function declared with the given anchor
+	const string &FindFunction(uint64_t id) const;
+	//! Returns the number of columns a relation produces, without requiring it to be bound
+	idx_t GetColumnCount(Relation &relation);
+	//! Stops deferring the binding of the relations created from here on
+	void EndDeferredBinding();
 
 	//! Transform Substrait Sort Order to DuckDB Order
 	OrderByNode TransformOrder(const substrait::SortField &sordf);
 	//! DuckDB Client Context
 	shared_ptr<ClientContext> context;
+	//! Context wrapper of the created relations, defers their binding until the plan is transformed
+	shared_ptr<DeferredBindContextWrapper> context_wrapper;
+	//! Column counts of the relations that have not been bound yet
+	unordered_map<const Relation *, idx_t> column_counts;
 	//! CTEs
 	vector<shared_ptr<Relation>> ctes;
 	//! Substrait Plan
-	substrait::Plan plan;
-	//! Variable used to register functions
-	unordered_map<uint64_t, string> functions_map;
+	shared_ptr<substrait::Plan> plan;
+	//! Functions declared in the plan, indexed by their anchor. Anchors are usually handed out sequentially, those
+	//! too large for the table to stay proportional to the number of functions are kept in sparse_functions.
+	vector<SubstraitFunction> functions;
+	unordered_map<uint64_t, SubstraitFunction> sparse_functions;
 	//! Remapped functions with differing names to the correct DuckDB functions
 	//! names
 	static const unordered_map<std::string, std::string> function_names_remap;
 	static const case_insensitive_set_t valid_extract_subfields;
+	//! Scalar functions that need special handling, by name without the signature suffix
+	static const unordered_map<std::string, SubstraitFunctionKind> function_kinds;
 	vector<ParsedExpression *> struct_expressions;
 	//! If we should acquire a client context lock when creating the relatiosn
 	const bool acquire_lock;
+	//! IN lists with at least this many literal options are probed through a hash join, 0 disables this
+	const idx_t in_list_join_threshold;
+	//! How deep relations and expressions may nest, and how deep the transformation currently is
+	const idx_t max_plan_depth;
+	idx_t plan_depth = 0;
 };
 } // namespace duckdb
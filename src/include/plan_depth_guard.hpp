@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// plan_depth_guard.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+//! Setting holding how deep relations and expressions may nest when transforming a plan in either direction
+static constexpr const char *MAX_PLAN_DEPTH_SETTING = "substrait_max_plan_depth";
+static constexpr idx_t DEFAULT_MAX_PLAN_DEPTH = 1000;
+//! The transformers and the protobuf parser recurse once or more per level, so the setting is capped at a depth whose
+//! recursion still fits comfortably into a thread's default stack
+static constexpr idx_t MAX_PLAN_DEPTH_LIMIT = 2000;
+
+//! Rejects depths above MAX_PLAN_DEPTH_LIMIT when the setting is changed
+inline void SetMaxPlanDepth(ClientContext &context, SetScope scope, Value &parameter) {
+	if (!parameter.IsNull() && parameter.GetValue<uint64_t>() > MAX_PLAN_DEPTH_LIMIT) {
+		throw InvalidInputException("%s can be at most %llu", MAX_PLAN_DEPTH_SETTING, MAX_PLAN_DEPTH_LIMIT);
+	}
+}
+
+inline idx_t GetMaxPlanDepth(ClientContext &context) {
+	Value max_depth;
+	if (context.TryGetCurrentSetting(MAX_PLAN_DEPTH_SETTING, max_depth) && !max_depth.IsNull()) {
+		return MinValue<idx_t>(max_depth.GetValue<uint64_t>(), MAX_PLAN_DEPTH_LIMIT);
+	}
+	return DEFAULT_MAX_PLAN_DEPTH;
+}
+
+//! Both transformers recurse once per nested relation and expression. The guard counts that nesting while it is in
+//! scope, so a plan that is too deep fails with an error instead of overflowing the stack.
+class PlanDepthGuard {
+public:
+	PlanDepthGuard(idx_t &depth_p, idx_t max_depth) : depth(depth_p) {
+		if (depth >= max_depth) {
+			throw InvalidInputException("Substrait plan exceeds the maximum depth of %llu nested relations and "
+			                            "expressions, use \"SET %s TO x\" to increase it up to %llu",
+			                            max_depth, MAX_PLAN_DEPTH_SETTING, MAX_PLAN_DEPTH_LIMIT);
+		}
+		depth++;
+	}
+	~PlanDepthGuard() {
+		depth--;
+	}
+
+private:
+	idx_t &depth;
+};
+
+} // namespace duckdb
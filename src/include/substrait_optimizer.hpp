@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// substrait_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/optimizer_type.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class Binder;
+class ClientContext;
+class LogicalOperator;
+
+//! The DuckDB commit the pass list of OptimizeForSubstrait was taken from. Bumping DuckDB fails the tests until the
+//! list has been compared with Optimizer::Optimize of the new version and this is updated.
+static constexpr const char *SUBSTRAIT_OPTIMIZER_DUCKDB_SOURCE_ID = "d8cdaa33fda8df955cc76ef58a280f68f4cd43fa";
+
+//! Optimizes a plan that is about to be transformed into Substrait. DuckDB's optimizer only skips the passes disabled
+//! in the database config, which is shared by all connections, so the built-in passes are run here instead, leaving
+//! out the ones that produce operators Substrait cannot express. Passes the user disabled are skipped as well, and
+//! nothing is changed on the database. Optimizer extensions are not run.
+unique_ptr<LogicalOperator> OptimizeForSubstrait(Binder &binder, ClientContext &context,
+                                                 unique_ptr<LogicalOperator> plan);
+
+//! Every optimizer type OptimizeForSubstrait knows about, whether it runs the pass or leaves it out
+vector<OptimizerType> GetSubstraitOptimizerTypes();
+
+} // namespace duckdb
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// substrait_plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include <list>
+
+namespace duckdb {
+
+struct SubstraitPlanCacheStats {
+	idx_t entries = 0;
+	idx_t capacity = 0;
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+};
+
+//! A bounded, thread-safe LRU cache of plans, keyed by a hash of the source they were created
+//! from (a serialized Substrait plan or a SQL query) plus whatever else the caller folds into
+//! the key. Every entry keeps a copy of its source, so a hash collision is a miss, never a
+//! wrong plan.
+template <class T>
+class SubstraitPlanCache {
+public:
+	//! Returns the cached value for the given key and source, or nullptr on a miss
+	shared_ptr<T> Get(hash_t key, const string &source) {
+		lock_guard<mutex> guard(lock);
+		auto entry = entries.find(key);
+		if (entry == entries.end() || entry->second->source != source) {
+			misses++;
+			return nullptr;
+		}
+		hits++;
+		// Move the entry to the front, it is now the most recently used one
+		lru.splice(lru.begin(), lru, entry->second);
+		return entry->second->value;
+	}
+
+	//! Inserts (or replaces) the value for the given key, evicting the least recently used
+	//! entries if the cache is full
+	void Put(hash_t key, string source, shared_ptr<T> value) {
+		lock_guard<mutex> guard(lock);
+		if (capacity == 0) {
+			return;
+		}
+		auto entry = entries.find(key);
+		if (entry != entries.end()) {
+			lru.erase(entry->second);
+			entries.erase(entry);
+		}
+		lru.push_front(CacheEntry {key, std::move(source), std::move(value)});
+		entries[key] = lru.begin();
+		EvictInternal();
+	}
+
+	//! Sets the maximum number of entries; shrinking the cache evicts the least recently used ones
+	void Resize(idx_t new_capacity) {
+		lock_guard<mutex> guard(lock);
+		capacity = new_capacity;
+		EvictInternal();
+	}
+
+	SubstraitPlanCacheStats GetStats() {
+		lock_guard<mutex> guard(lock);
+		SubstraitPlanCacheStats stats;
+		stats.entries = entries.size();
+		stats.capacity = capacity;
+		stats.hits = hits;
+		stats.misses = misses;
+		stats.evictions = evictions;
+		return stats;
+	}
+
+private:
+	struct CacheEntry {
+		hash_t key;
+		string source;
+		shared_ptr<T> value;
+	};
+
+	void EvictInternal() {
+		while (entries.size() > capacity) {
+			entries.erase(lru.back().key);
+			lru.pop_back();
+			evictions++;
+		}
+	}
+
+	mutex lock;
+	idx_t capacity = 0;
+	//! Entries ordered from most to least recently used
+	std::list<CacheEntry> lru;
+	unordered_map<hash_t, typename std::list<CacheEntry>::iterator> entries;
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+};
+
+} // namespace duckdb
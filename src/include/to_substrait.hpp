@@ -9,13 +9,18 @@
 #pragma once
 
 #include "custom_extensions/custom_extensions.hpp"
+#include "plan_depth_guard.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/types/type_map.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/main/connection.hpp"
 #include "duckdb/planner/bound_result_modifier.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/joinside.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/io/zero_copy_stream.h"
 #include "substrait/algebra.pb.h"
 #include "substrait/plan.pb.h"
 #include <string>
@@ -25,21 +30,28 @@ namespace duckdb {
 class DuckDBToSubstrait {
 public:
 	explicit DuckDBToSubstrait(ClientContext &context, LogicalOperator &dop, bool strict_p,
-	                           vector<string> plan_names_p = {})
-	    : context(context), strict(strict_p), plan_names(std::move(plan_names_p)) {
+	                           vector<string> plan_names_p = {}, string values_spill_directory_p = "",
+	                           bool compact_in_filters_p = false, bool emit_statistics_p = false)
+	    : plan(google::protobuf::Arena::Create<substrait::Plan>(&arena)), context(context), strict(strict_p),
+	      plan_names(std::move(plan_names_p)), values_spill_directory(std::move(values_spill_directory_p)),
+	      compact_in_filters(compact_in_filters_p), emit_statistics(emit_statistics_p),
+	      max_plan_depth(GetMaxPlanDepth(context)) {
 		TransformPlan(dop);
 	};
-
-	~DuckDBToSubstrait() {
-		plan.Clear();
-	}
 	//! Serializes the substrait plan to a string
 	string SerializeToString() const;
 	string SerializeToJson() const;
+	//! Serializes the substrait plan into a stream, without materializing it in memory first
+	void SerializeToStream(google::protobuf::io::ZeroCopyOutputStream &output) const;
 
 private:
 	//! Transform DuckDB Plan to Substrait Plan
 	void TransformPlan(LogicalOperator &dop);
+	//! Allocates a message on the arena of the plan, the plan owns it
+	template <class T>
+	T *NewMessage() {
+		return google::protobuf::Arena::Create<T>(&arena);
+	}
 	//! Registers a function
 	uint64_t RegisterFunction(const std::string &name, vector<::substrait::Type> &args_types);
 	//! Creates a reference to a table column
@@ -48,7 +60,7 @@ private:
 	static vector<string> DepthFirstNames(const LogicalType &type);
 	static void DepthFirstNamesRecurse(vector<string> &names, const LogicalType &type);
 	static substrait::Expression_Literal ToExpressionLiteral(const substrait::Expression &expr);
-	static void SetTableSchema(const TableCatalogEntry &table, substrait::NamedStruct *schema);
+	void SetTableSchema(const TableCatalogEntry &table, substrait::NamedStruct *schema) const;
 	static void SetNamedTable(const TableCatalogEntry &table, substrait::WriteRel *writeRel);
 
 	//! Transforms Relation Root
@@ -58,6 +70,9 @@ private:
 
 	//! Methods to Transform Logical Operators to Substrait Relations
 	substrait::Rel *TransformOp(LogicalOperator &dop);
+	substrait::Rel *TransformOperator(LogicalOperator &dop);
+	//! Sets the row count and record size hints of rel from the estimates of the operator it was transformed from
+	void SetStatisticsHint(LogicalOperator &dop, substrait::Rel &rel);
 	substrait::Rel *TransformFilter(LogicalOperator &dop);
 	substrait::Rel *TransformProjection(LogicalOperator &dop);
 	substrait::Rel *TransformTopN(LogicalOperator &dop);
@@ -68,6 +83,10 @@ private:
 	substrait::Rel *TransformAggregateGroup(LogicalOperator &dop);
 	substrait::Rel *TransformWindow(LogicalOperator &dop);
 	substrait::Rel *TransformExpressionGet(LogicalOperator &dop);
+	//! Writes the rows of a constant LogicalExpressionGet to a Parquet file, and returns a read of that file. Returns
+	//! nullptr if the rows are not constant or their types do not read back from Parquet exactly. The file is named
+	//! after its contents and is never removed, its lifetime is up to the caller
+	substrait::Rel *SpillExpressionGet(LogicalOperator &dop);
 	substrait::Rel *TransformGet(LogicalOperator &dop);
 	substrait::Rel *TransformCrossProduct(LogicalOperator &dop);
 	substrait::Rel *TransformUnion(LogicalOperator &dop);
@@ -83,9 +102,9 @@ private:
 	//! Returns the RelCommon of the concrete relation held by rel, or nullptr for
 	//! relation types that are never produced by this transformer.
 	static substrait::RelCommon *GetRelCommon(substrait::Rel &rel);
-	static substrait::Rel *TransformDummyScan();
+	substrait::Rel *TransformDummyScan();
 	substrait::Rel *TransformEmptyResult(LogicalOperator &dop);
-	static substrait::RelCommon *CreateOutputMapping(vector<int32_t> vector);
+	substrait::RelCommon *CreateOutputMapping(vector<int32_t> vector);
 	static bool IsPassthroughProjection(LogicalProjection &dproj, idx_t child_column_count, bool &needs_output_mapping);
 	//! Methods to transform different LogicalGet Types (e.g., Table, Parquet)
 	//! To Substrait;
@@ -125,9 +144,17 @@ private:
 	void TransformCoalesceExpression(Expression &dexpr, substrait::Expression &sexpr, uint64_t col_offset);
 	void TransformCaseExpression(Expression &dexpr, substrait::Expression &sexpr);
 	void TransformInExpression(Expression &dexpr, substrait::Expression &sexpr);
-	//! Transforms a DuckDB Logical Type into a Substrait Type
-	static substrait::Type DuckToSubstraitType(const LogicalType &type, BaseStatistics *column_statistics = nullptr,
-	                                           bool not_null = false);
+	//! Transforms a condition of a filter relation, where IN lists can be emitted compactly if requested
+	void TransformFilterCondition(Expression &dexpr, substrait::Expression &sexpr);
+	//! Writes "index_in(value, [values]) IS NOT NULL" to sexpr, returns the argument the value has to be written to
+	substrait::Expression &CreateCompactInList(const LogicalType &value_type, const vector<Value> &values,
+	                                           const LogicalType &return_type, substrait::Expression &sexpr);
+	//! Transforms a DuckDB Logical Type into a Substrait Type. Every (type, nullability) is built once and cached
+	//! on the transformer, the returned reference is valid for as long as the transformer is
+	const substrait::Type &DuckToSubstraitType(const LogicalType &type, BaseStatistics *column_statistics = nullptr,
+	                                           bool not_null = false) const;
+	//! Builds the Substrait Type of a DuckDB Logical Type, including the types of its children
+	static substrait::Type CreateSubstraitType(const LogicalType &type, bool not_null);
 
 	//! Methods to transform DuckDB Filters to Substrait Expression
 	substrait::Expression *TransformFilter(uint64_t col_idx, const LogicalType &column_type, const TableFilter &dfilter,
@@ -158,34 +185,34 @@ private:
 	static std::string &RemapFunctionName(std::string &function_name);
 	static bool IsExtractFunction(const string &function_name);
 
-	//! Creates a Conjunction
+	//! Creates a Conjunction, as a single variadic call (e.g. and:bool) over all of its children
 	template <typename T, typename FUNC>
 	substrait::Expression *CreateConjunction(T &source, const FUNC f, const string &name = "and") {
-		substrait::Expression *res = nullptr;
+		vector<substrait::Expression *> child_expressions;
 		for (auto &ele : source) {
 			auto child_expression = f(ele);
 			// Skip null expressions (filters that cannot be pushed down)
-			if (!child_expression) {
-				continue;
-			}
-			if (!res) {
-				res = child_expression;
-			} else {
-
-				auto temp_expr = new substrait::Expression();
-				auto scalar_fun = temp_expr->mutable_scalar_function();
-				LogicalType boolean_type(LogicalTypeId::BOOLEAN);
-
-				vector<::substrait::Type> args_types {DuckToSubstraitType(boolean_type),
-				                                      DuckToSubstraitType(boolean_type)};
-
-				scalar_fun->set_function_reference(RegisterFunction(name, args_types));
-				*scalar_fun->mutable_output_type() = DuckToSubstraitType(boolean_type);
-				AllocateFunctionArgument(scalar_fun, res);
-				AllocateFunctionArgument(scalar_fun, child_expression);
-				res = temp_expr;
+			if (child_expression) {
+				child_expressions.push_back(child_expression);
 			}
 		}
+		if (child_expressions.empty()) {
+			return nullptr;
+		}
+		if (child_expressions.size() == 1) {
+			return child_expressions[0];
+		}
+		auto res = NewMessage<substrait::Expression>();
+		auto scalar_fun = res->mutable_scalar_function();
+		LogicalType boolean_type(LogicalTypeId::BOOLEAN);
+
+		vector<::substrait::Type> args_types(child_expressions.size(), DuckToSubstraitType(boolean_type));
+
+		scalar_fun->set_function_reference(RegisterFunction(name, args_types));
+		*scalar_fun->mutable_output_type() = DuckToSubstraitType(boolean_type);
+		for (auto child_expression : child_expressions) {
+			AllocateFunctionArgument(scalar_fun, child_expression);
+		}
 		return res;
 	}
 
@@ -206,9 +233,35 @@ private:
 	//! Last plan-unique computation id handed out for saved/loaded computation hints.
 	int32_t last_computation_id = 0;
 
+	//! A function call as RegisterFunction resolves it: the interned function name and the kind of every argument
+	struct FunctionCallKey {
+		idx_t name_id;
+		vector<int32_t> arg_kinds;
+		bool operator==(const FunctionCallKey &other) const {
+			return name_id == other.name_id && arg_kinds == other.arg_kinds;
+		}
+	};
+	struct HashFunctionCallKey {
+		size_t operator()(const FunctionCallKey &key) const noexcept {
+			auto hash = Hash(key.name_id);
+			for (auto &kind : key.arg_kinds) {
+				hash = CombineHash(hash, Hash(kind));
+			}
+			return hash;
+		}
+	};
+
+	//! Substrait types built by DuckToSubstraitType, for nullable and for required values
+	mutable type_map_t<substrait::Type> nullable_types;
+	mutable type_map_t<substrait::Type> required_types;
+
 	//! Variables used to register functions
 	unordered_map<string, uint64_t> functions_map;
 	unordered_map<string, uint64_t> extension_urn_map;
+	//! Ids of the function names seen by RegisterFunction
+	unordered_map<string, idx_t> function_name_ids;
+	//! Anchors of the function calls already registered, so repeated calls skip the extension lookup
+	unordered_map<FunctionCallKey, uint64_t, HashFunctionCallKey> function_call_anchors;
 
 	//! Remapped DuckDB functions names to Substrait compatible function names
 	static const unordered_map<std::string, std::string> function_names_remap;
@@ -217,8 +270,10 @@ private:
 	static const SubstraitCustomFunctions custom_functions;
 	uint64_t last_function_id = 1;
 	uint64_t last_urn_id = 1;
+	//! Arena the plan and all of its messages are allocated on, freeing them at once
+	google::protobuf::Arena arena;
 	//! The substrait Plan
-	substrait::Plan plan;
+	substrait::Plan *plan;
 	ClientContext &context;
 	//! Map the CTE index to the Substrait reference
 	vector<uint32_t> cte_indices;
@@ -227,6 +282,19 @@ private:
 	bool strict;
 	//! Output column names from the planner (fallback when no projection in plan)
 	vector<string> plan_names;
+	//! If set, large constant inputs are written to Parquet files in this directory instead of
+	//! being inlined in the plan
+	string values_spill_directory;
+	//! Writes the spilled inputs, created on the first input that is spilled
+	unique_ptr<Connection> spill_connection;
+	//! If set, pushed down IN filters are emitted as index_in on a list literal, instead of as a
+	//! SingularOrList with an expression per value
+	bool compact_in_filters;
+	//! If set, every relation carries the estimated row count and record size of its operator as a hint
+	bool emit_statistics;
+	//! How deep operators and expressions may nest, and how deep the transformation currently is
+	const idx_t max_plan_depth;
+	idx_t plan_depth = 0;
 	string errors;
 };
 } // namespace duckdb
@@ -2,6 +2,8 @@
 
 #include "substrait_extension.hpp"
 #include "from_substrait.hpp"
+#include "substrait_optimizer.hpp"
+#include "substrait_plan_cache.hpp"
 #include "to_substrait.hpp"
 
 #include "duckdb.hpp"
@@ -11,22 +13,50 @@
 #include "duckdb/planner/planner.hpp"
 
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/settings.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #endif
 
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+
 namespace duckdb {
 
 void do_nothing(ClientContext *) {
 }
 
+//! A consumed plan, as cached by from_substrait and from_substrait_json
+struct ConsumedSubstraitPlan {
+	//! The parsed Substrait plan
+	shared_ptr<substrait::Plan> plan;
+	//! The table reference bind_replace substitutes for a read-only plan, nullptr otherwise
+	unique_ptr<TableRef> table_ref;
+};
+
+//! State shared by the Substrait table functions of a database
+struct SubstraitFunctionInfo : public TableFunctionInfo {
+	//! Plans consumed by from_substrait and from_substrait_json
+	SubstraitPlanCache<ConsumedSubstraitPlan> consumer_cache;
+	//! Plans produced by get_substrait and get_substrait_json
+	SubstraitPlanCache<string> producer_cache;
+};
+
 struct ToSubstraitFunctionData : public TableFunctionData {
 	ToSubstraitFunctionData() = default;
 	string query;
@@ -36,55 +66,48 @@ struct ToSubstraitFunctionData : public TableFunctionData {
 	bool finished = false;
 	//! Output column names from the planner
 	vector<string> plan_names;
-	//! Original options from the connection
-	ClientConfig original_config;
-	set<OptimizerType> original_disabled_optimizers;
+	//! The file the plan is written to by get_substrait_to_file
+	string path;
+	//! Directory large constant inputs are written to as Parquet files, instead of being inlined in the plan
+	string values_spill_directory;
+	//! Emit pushed down IN filters with their values in a single list literal
+	bool compact_in_filters = false;
+	//! Attach the estimated row count and record size of every relation as hints
+	bool emit_statistics = false;
+	//! The cache of the produced plans of this database
+	SubstraitPlanCache<string> *producer_cache = nullptr;
 
-	// Setup configurations
-	void PrepareConnection(ClientContext &context) {
-		// First collect original options
-		original_config = context.config;
-		original_disabled_optimizers = DBConfig::GetConfig(context).options.disabled_optimizers;
+	unique_ptr<LogicalOperator> ExtractPlan(ClientContext &context) {
+		return ExtractPlan(context, query, plan_names);
+	}
 
+	//! Plans the given query with the options of this function, names receives the names of its result columns
+	unique_ptr<LogicalOperator> ExtractPlan(ClientContext &context, const string &sql, vector<string> &names) const {
+		// The options are set on the connection only, and restored afterwards
+		auto original_config = context.config;
 		// The user might want to disable the optimizer of the new connection
 		context.config.enable_optimizer = enable_optimizer;
 		context.config.use_replacement_scans = false;
-		// We want for sure to disable the internal compression optimizations.
-		// These are DuckDB specific, no other system implements these. Also,
-		// respect the user's settings if they chose to disable any specific optimizers.
-		//
-		// The InClauseRewriter optimization converts large `IN` clauses to a
-		// "mark join" against a `ColumnDataCollection`, which may not make
-		// sense in other systems and would complicate the conversion to Substrait.
-		set<OptimizerType> disabled_optimizers = DBConfig::GetConfig(context).options.disabled_optimizers;
-		disabled_optimizers.insert(OptimizerType::IN_CLAUSE);
-		disabled_optimizers.insert(OptimizerType::COMPRESSED_MATERIALIZATION);
-		disabled_optimizers.insert(OptimizerType::MATERIALIZED_CTE);
-		// The CommonSubplan optimizer deduplicates repeated subplans into
-		// materialized CTEs, which cannot be expressed in Substrait.
-		disabled_optimizers.insert(OptimizerType::COMMON_SUBPLAN);
 		// If error(varchar) gets implemented in substrait this can be removed
-		DBConfig::GetConfig(context).SetOption(ScalarSubqueryErrorOnMultipleRowsSetting::Name, false);
-		DBConfig::GetConfig(context).options.disabled_optimizers = disabled_optimizers;
-	}
+		context.config.set_variables[ScalarSubqueryErrorOnMultipleRowsSetting::Name] = Value::BOOLEAN(false);
 
-	unique_ptr<LogicalOperator> ExtractPlan(ClientContext &context) {
-		PrepareConnection(context);
 		unique_ptr<LogicalOperator> plan;
 		try {
 			Parser parser(context.GetParserOptions());
-			parser.ParseQuery(query);
+			parser.ParseQuery(sql);
+			if (parser.statements.empty()) {
+				throw InvalidInputException("Cannot produce a Substrait plan from an empty query");
+			}
 
 			Planner planner(context);
 			planner.CreatePlan(std::move(parser.statements[0]));
 			D_ASSERT(planner.plan);
 
-			plan_names = planner.names;
+			names = planner.names;
 			plan = std::move(planner.plan);
 
 			if (context.config.enable_optimizer) {
-				Optimizer optimizer(*planner.binder, context);
-				plan = optimizer.Optimize(std::move(plan));
+				plan = OptimizeForSubstrait(*planner.binder, context, std::move(plan));
 			}
 
 			plan->ResolveOperatorTypes();
@@ -93,18 +116,12 @@ struct ToSubstraitFunctionData : public TableFunctionData {
 			resolver.VisitOperator(*plan);
 			plan->ResolveOperatorTypes();
 		} catch (...) {
-			CleanupConnection(context);
+			context.config = original_config;
 			throw;
 		}
 
-		CleanupConnection(context);
-		return plan;
-	}
-
-	// Reset configuration
-	void CleanupConnection(ClientContext &context) const {
-		DBConfig::GetConfig(context).options.disabled_optimizers = original_disabled_optimizers;
 		context.config = original_config;
+		return plan;
 	}
 };
 
@@ -122,6 +139,15 @@ static void SetOptions(ToSubstraitFunctionData &function, const ClientConfig &co
 		if (loption == "strict") {
 			function.strict = BooleanValue::Get(param.second);
 		}
+		if (loption == "values_spill_directory" && !param.second.IsNull()) {
+			function.values_spill_directory = StringValue::Get(param.second);
+		}
+		if (loption == "compact_in_filters") {
+			function.compact_in_filters = BooleanValue::Get(param.second);
+		}
+		if (loption == "emit_statistics") {
+			function.emit_statistics = BooleanValue::Get(param.second);
+		}
 	}
 	if (!optimizer_option_set) {
 		// If the user has not specified what they want, fall back to the settings
@@ -136,6 +162,8 @@ static unique_ptr<ToSubstraitFunctionData> InitToSubstraitFunctionData(const Cli
                                                                        TableFunctionBindInput &input) {
 	auto result = make_uniq<ToSubstraitFunctionData>();
 	result->query = input.inputs[0].ToString();
+	auto &info = input.info->Cast<SubstraitFunctionInfo>();
+	result->producer_cache = &info.producer_cache;
 	SetOptions(*result, config, input.named_parameters);
 	return result;
 }
@@ -155,11 +183,25 @@ static unique_ptr<FunctionData> ToJsonBind(ClientContext &context, TableFunction
 }
 
 shared_ptr<Relation> SubstraitPlanToDuckDBRel(shared_ptr<ClientContext> &context, const string &serialized,
-                                              bool json = false, bool acquire_lock = false) {
-	SubstraitToDuckDB transformer_s2d(context, serialized, json, acquire_lock);
+                                              const SubstraitConsumerSettings &settings, bool json = false,
+                                              bool acquire_lock = false) {
+	SubstraitToDuckDB transformer_s2d(context, serialized, settings, json, acquire_lock);
 	return transformer_s2d.TransformPlan();
 }
 
+//! Reads a serialized plan from a file through the client's file system, in a single read straight into
+//! the buffer that is parsed, so the plan never passes through a SQL value
+static string ReadPlanFile(ClientContext &context, const string &path) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto file_size = handle->GetFileSize();
+	string serialized(file_size, '\0');
+	if (file_size > 0) {
+		handle->Read(&serialized[0], file_size, 0);
+	}
+	return serialized;
+}
+
 //! This function matches results of substrait plans with direct Duckdb queries
 //! Is only executed when pragma enable_verification = true
 //! It creates extra connections to be able to execute the consumed DuckDB Plan
@@ -171,7 +213,8 @@ static void VerifySubstraitRoundtrip(unique_ptr<LogicalOperator> &query_plan, Cl
 	auto con = Connection(*context.db);
 	auto actual_result = con.Query(data.query);
 	auto con_2 = Connection(*context.db);
-	auto sub_relation = SubstraitPlanToDuckDBRel(con_2.context, serialized, is_json, true);
+	auto sub_relation =
+	    SubstraitPlanToDuckDBRel(con_2.context, serialized, SubstraitConsumerSettings(context), is_json, true);
 	auto substrait_result = sub_relation->Execute();
 	substrait_result->names = actual_result->names;
 	unique_ptr<MaterializedQueryResult> substrait_materialized;
@@ -212,11 +255,105 @@ static void VerifyJSONRoundtrip(unique_ptr<LogicalOperator> &query_plan, ClientC
 	VerifySubstraitRoundtrip(query_plan, context, data, serialized, true);
 }
 
+static constexpr const char *PLAN_CACHE_SIZE_SETTING = "substrait_plan_cache_size";
+
+static idx_t GetPlanCacheSize(const Value &setting) {
+	return setting.IsNull() ? 0 : setting.GetValue<uint64_t>();
+}
+
+//! The caches are shared by all connections of a database, so they are sized by the global value of the setting
+//! only. A connection uses the cache if its own value of the setting is not 0 as well, which allows opting out.
+//! Returns whether this connection uses the cache.
+template <class T>
+static bool EnablePlanCache(ClientContext &context, SubstraitPlanCache<T> &cache) {
+	Value setting;
+	idx_t capacity = 0;
+	if (context.db->TryGetCurrentSetting(PLAN_CACHE_SIZE_SETTING, setting)) {
+		capacity = GetPlanCacheSize(setting);
+	}
+	cache.Resize(capacity);
+	if (capacity == 0) {
+		return false;
+	}
+	return !context.TryGetCurrentSetting(PLAN_CACHE_SIZE_SETTING, setting) || GetPlanCacheSize(setting) > 0;
+}
+
+//! Folds the attached catalogs and their versions into a cache key, so any DDL on a catalog a plan might be resolved
+//! against yields a new key. Returns false if a catalog does not track versions, in which case the plan must not be
+//! cached.
+static bool CombineCatalogVersions(ClientContext &context, hash_t &key) {
+	auto combine = [&](Catalog &catalog) {
+		auto version = catalog.GetCatalogVersion(context);
+		if (!version.IsValid()) {
+			return false;
+		}
+		key = CombineHash(key, Hash(catalog.GetName().c_str()));
+		key = CombineHash(key, Hash<uint64_t>(version.GetIndex()));
+		return true;
+	};
+	if (!combine(Catalog::GetCatalog(context, TEMP_CATALOG))) {
+		return false;
+	}
+	for (auto &database : DatabaseManager::Get(context).GetDatabases(context)) {
+		if (!combine(database->GetCatalog())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Computes the key under which a consumed plan is cached. Besides the serialized plan, the
+//! transformed relations depend on the catalog they were resolved against and the consumer settings.
+static bool GetConsumerCacheKey(ClientContext &context, const string &serialized, bool is_json,
+                                const SubstraitConsumerSettings &settings, hash_t &key) {
+	key = Hash(serialized.c_str(), serialized.size());
+	key = CombineHash(key, Hash<uint64_t>(is_json ? 1 : 0));
+	key = CombineHash(key, Hash<uint64_t>(settings.in_list_join_threshold));
+	key = CombineHash(key, Hash<uint64_t>(settings.max_plan_depth));
+	return CombineCatalogVersions(context, key);
+}
+
+//! Settings that change how get_substrait binds or optimizes a query, and thereby the plan it produces
+static constexpr const char *PRODUCER_PLANNING_SETTINGS[] = {
+    "default_null_order",       "default_order",   "disabled_optimizers", "integer_division",
+    "preserve_identifier_case", MAX_PLAN_DEPTH_SETTING};
+
+//! Computes the key under which a produced plan is cached. The source compared on a hit holds the
+//! query as well as the options, search path and settings it was produced with. Plans spilling
+//! values to files are not cached, the files might be gone by the time the plan is served again.
+//! Neither are plans with statistics hints, their estimates change with the data.
+static bool GetProducerCacheKey(ClientContext &context, const ToSubstraitFunctionData &data, bool is_json,
+                                hash_t &key, string &source) {
+	if (!data.values_spill_directory.empty() || data.emit_statistics) {
+		return false;
+	}
+	source.clear();
+	source += is_json ? 'j' : 'b';
+	source += data.enable_optimizer ? '1' : '0';
+	source += data.strict ? '1' : '0';
+	source += data.compact_in_filters ? '1' : '0';
+	// Unqualified names are resolved through the search path
+	for (auto &entry : ClientData::Get(context).catalog_search_path->Get()) {
+		source += entry.ToString();
+		source += ',';
+	}
+	for (auto setting : PRODUCER_PLANNING_SETTINGS) {
+		Value value;
+		context.TryGetCurrentSetting(setting, value);
+		source += value.ToString();
+		source += ',';
+	}
+	source += StringUtil::Strip(data.query);
+	key = Hash(source.c_str(), source.size());
+	return CombineCatalogVersions(context, key);
+}
+
 static void ToSubFunctionInternal(ClientContext &context, ToSubstraitFunctionData &data, DataChunk &output,
                                   unique_ptr<LogicalOperator> &query_plan, string &serialized) {
 	output.SetCardinality(1);
 	query_plan = data.ExtractPlan(context);
-	auto transformer_d2s = DuckDBToSubstrait(context, *query_plan, data.strict, data.plan_names);
+	DuckDBToSubstrait transformer_d2s(context, *query_plan, data.strict, data.plan_names,
+	                                  data.values_spill_directory, data.compact_in_filters, data.emit_statistics);
 	serialized = transformer_d2s.SerializeToString();
 	output.SetValue(0, 0, Value::BLOB_RAW(serialized));
 }
@@ -225,25 +362,53 @@ static void ToJsonFunctionInternal(ClientContext &context, ToSubstraitFunctionDa
                                    unique_ptr<LogicalOperator> &query_plan, string &serialized) {
 	output.SetCardinality(1);
 	query_plan = data.ExtractPlan(context);
-	auto transformer_d2s = DuckDBToSubstrait(context, *query_plan, data.strict, data.plan_names);
+	DuckDBToSubstrait transformer_d2s(context, *query_plan, data.strict, data.plan_names,
+	                                  data.values_spill_directory, data.compact_in_filters, data.emit_statistics);
 	serialized = transformer_d2s.SerializeToJson();
 	output.SetValue(0, 0, serialized);
 }
 
+//! Produces the plan of a get_substrait or get_substrait_json call, serving it from the producer cache if possible
+static void ToSubstraitCachedFunction(ClientContext &context, ToSubstraitFunctionData &data, DataChunk &output,
+                                      bool is_json) {
+	auto &cache = *data.producer_cache;
+	hash_t key;
+	string source;
+	bool use_cache = EnablePlanCache(context, cache) && GetProducerCacheKey(context, data, is_json, key, source);
+	if (use_cache) {
+		auto cached = cache.Get(key, source);
+		if (cached) {
+			output.SetCardinality(1);
+			output.SetValue(0, 0, is_json ? Value(*cached) : Value::BLOB_RAW(*cached));
+			return;
+		}
+	}
+	unique_ptr<LogicalOperator> query_plan;
+	auto serialized = make_shared_ptr<string>();
+	if (is_json) {
+		ToJsonFunctionInternal(context, data, output, query_plan, *serialized);
+	} else {
+		ToSubFunctionInternal(context, data, output, query_plan, *serialized);
+	}
+	if (use_cache) {
+		cache.Put(key, std::move(source), std::move(serialized));
+	}
+}
+
 static void ToSubFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &data = data_p.bind_data->CastNoConst<ToSubstraitFunctionData>();
 	if (data.finished) {
 		return;
 	}
-	unique_ptr<LogicalOperator> query_plan;
-	string serialized;
-	ToSubFunctionInternal(context, data, output, query_plan, serialized);
-
 	data.finished = true;
-
 	if (!context.config.query_verification_enabled) {
+		ToSubstraitCachedFunction(context, data, output, false);
 		return;
 	}
+	// Verification needs the plan the blob was produced from, so it always bypasses the cache
+	unique_ptr<LogicalOperator> query_plan;
+	string serialized;
+	ToSubFunctionInternal(context, data, output, query_plan, serialized);
 	VerifyBlobRoundtrip(query_plan, context, data, serialized);
 	// Also run the ToJson path and verify round-trip for that
 	DataChunk other_output;
@@ -257,15 +422,14 @@ static void ToJsonFunction(ClientContext &context, TableFunctionInput &data_p, D
 	if (data.finished) {
 		return;
 	}
-	unique_ptr<LogicalOperator> query_plan;
-	string serialized;
-	ToJsonFunctionInternal(context, data, output, query_plan, serialized);
-
 	data.finished = true;
-
 	if (!context.config.query_verification_enabled) {
+		ToSubstraitCachedFunction(context, data, output, true);
 		return;
 	}
+	unique_ptr<LogicalOperator> query_plan;
+	string serialized;
+	ToJsonFunctionInternal(context, data, output, query_plan, serialized);
 	VerifyJSONRoundtrip(query_plan, context, data, serialized);
 	// Also run the ToJson path and verify round-trip for that
 	DataChunk other_output;
@@ -274,45 +438,283 @@ static void ToJsonFunction(ClientContext &context, TableFunctionInput &data_p, D
 	VerifyBlobRoundtrip(query_plan, context, data, serialized);
 }
 
-static unique_ptr<TableRef> SubstraitBindReplace(ClientContext &context, TableFunctionBindInput &input, bool is_json) {
+static unique_ptr<FunctionData> ToSubFileBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("Bytes Written");
+	auto result = InitToSubstraitFunctionData(context.config, input);
+	if (input.inputs[1].IsNull()) {
+		throw BinderException("get_substrait_to_file cannot be called with a NULL path");
+	}
+	result->path = StringValue::Get(input.inputs[1]);
+	return std::move(result);
+}
+
+//! Size of the buffer the serialized plan is written to the file in
+static constexpr int PLAN_FILE_BUFFER_SIZE = 1 << 18;
+
+//! Hands the buffers protobuf serializes into over to a file handle. protobuf only learns
+//! that a write failed, so the error itself is kept to be rethrown afterwards.
+class PlanFileWriter : public google::protobuf::io::CopyingOutputStream {
+public:
+	explicit PlanFileWriter(FileHandle &handle) : handle(handle) {
+	}
+
+	bool Write(const void *buffer, int size) override {
+		try {
+			handle.Write(const_cast<void *>(buffer), NumericCast<idx_t>(size));
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+			return false;
+		}
+		return true;
+	}
+
+	FileHandle &handle;
+	ErrorData error;
+};
+
+static void ToSubFileFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<ToSubstraitFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	auto query_plan = data.ExtractPlan(context);
+	DuckDBToSubstrait transformer_d2s(context, *query_plan, data.strict, data.plan_names,
+	                                  data.values_spill_directory, data.compact_in_filters, data.emit_statistics);
+
+	// Stream the plan into the file instead of serializing it to a string first
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(data.path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	PlanFileWriter writer(*handle);
+	google::protobuf::io::CopyingOutputStreamAdaptor file_stream(&writer, PLAN_FILE_BUFFER_SIZE);
+	try {
+		transformer_d2s.SerializeToStream(file_stream);
+		if (!file_stream.Flush()) {
+			throw IOException("Could not write the substrait plan to \"%s\"", data.path);
+		}
+	} catch (...) {
+		if (writer.error.HasError()) {
+			writer.error.Throw();
+		}
+		throw;
+	}
+	handle->Sync();
+	handle->Close();
+
+	output.SetCardinality(1);
+	output.SetValue(0, 0, Value::UBIGINT(NumericCast<uint64_t>(file_stream.ByteCount())));
+	data.finished = true;
+
+	if (!context.config.query_verification_enabled) {
+		return;
+	}
+	VerifyBlobRoundtrip(query_plan, context, data, ReadPlanFile(context, data.path));
+}
+
+static unique_ptr<FunctionData> ToSubBatchBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.input_table_types.size() != 1 || input.input_table_types[0].id() != LogicalTypeId::VARCHAR) {
+		throw BinderException("get_substrait_batch expects a table with a single VARCHAR column of queries");
+	}
+	if (!context.transaction.IsAutoCommit()) {
+		throw BinderException("get_substrait_batch plans on connections of its own, which cannot see the changes of "
+		                      "an open transaction");
+	}
+	return_types.emplace_back(LogicalType::BLOB);
+	names.emplace_back("Plan Blob");
+	auto result = make_uniq<ToSubstraitFunctionData>();
+	SetOptions(*result, context.config, input.named_parameters);
+	return std::move(result);
+}
+
+struct ToSubstraitBatchLocalState : public LocalTableFunctionState {
+	//! Planning changes the config of the client it runs on, so every thread plans on a connection of its own
+	unique_ptr<Connection> conn;
+};
+
+static unique_ptr<LocalTableFunctionState> ToSubBatchInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *global_state) {
+	auto result = make_uniq<ToSubstraitBatchLocalState>();
+	result->conn = make_uniq<Connection>(*context.client.db);
+	// Plan with the settings and search path of the calling connection. Its temporary objects stay invisible.
+	result->conn->context->config = context.client.config;
+	auto &search_path = *ClientData::Get(context.client).catalog_search_path;
+	ClientData::Get(*result->conn->context)
+	    .catalog_search_path->Set(search_path.GetSetPaths(), CatalogSetPathType::SET_SCHEMAS);
+	return std::move(result);
+}
+
+//! Produces one plan per input query. The queries are spread over the threads that run the input pipeline, and each
+//! thread plans a whole chunk of them in a single transaction of its connection.
+static OperatorResultType ToSubBatchFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                             DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<ToSubstraitFunctionData>();
+	auto &lstate = data_p.local_state->Cast<ToSubstraitBatchLocalState>();
+	auto &client = *lstate.conn->context;
+
+	UnifiedVectorFormat queries;
+	input.data[0].ToUnifiedFormat(input.size(), queries);
+	auto query_data = UnifiedVectorFormat::GetData<string_t>(queries);
+	auto &result = output.data[0];
+	auto result_data = FlatVector::GetData<string_t>(result);
+	client.RunFunctionInTransaction([&]() {
+		for (idx_t row = 0; row < input.size(); row++) {
+			auto idx = queries.sel->get_index(row);
+			if (!queries.validity.RowIsValid(idx)) {
+				FlatVector::SetNull(result, row, true);
+				continue;
+			}
+			vector<string> plan_names;
+			auto query_plan = data.ExtractPlan(client, query_data[idx].GetString(), plan_names);
+			DuckDBToSubstrait transformer_d2s(client, *query_plan, data.strict, plan_names, data.values_spill_directory,
+			                                  data.compact_in_filters, data.emit_statistics);
+			result_data[row] = StringVector::AddStringOrBlob(result, transformer_d2s.SerializeToString());
+		}
+	});
+	output.SetCardinality(input.size());
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//! A plan transformed into a relation on its own connection
+struct TransformedSubstraitPlan {
+	//! The buffer of the argument (the serialized plan or its file path) the relation was transformed from. bind is
+	//! called with the same input values as bind_replace, so identifying the plan by its buffer avoids copying or
+	//! comparing it.
+	const char *source_data = nullptr;
+	idx_t source_size = 0;
+	bool is_json = false;
+
+	bool IsTransformedFrom(const string &argument, bool is_json_p) const {
+		return source_data == argument.data() && source_size == argument.size() && is_json == is_json_p;
+	}
+	unique_ptr<Connection> conn;
+	shared_ptr<Relation> relation;
+};
+
+//! Hands a plan that bind_replace transformed, but could not replace, over to bind, so
+//! a non-read-only plan is only parsed and transformed once
+struct SubstraitBindState : public ClientContextState {
+	unique_ptr<TransformedSubstraitPlan> pending;
+
+	void QueryEnd() override {
+		pending.reset();
+	}
+};
+
+static SubstraitBindState &GetBindState(ClientContext &context) {
+	return *context.registered_state->GetOrCreate<SubstraitBindState>("substrait_bind");
+}
+
+//! Returns the argument of a from_substrait call: the serialized plan, or the path of the file holding it
+static const string &GetPlanArgument(TableFunctionBindInput &input) {
 	if (input.inputs[0].IsNull()) {
-		throw BinderException("from_substrait cannot be called with a NULL parameter");
+		throw BinderException("%s cannot be called with a NULL parameter", input.table_function.name);
+	}
+	return StringValue::Get(input.inputs[0]);
+}
+
+//! Returns the parsed plan of a from_substrait call, and for read-only plans the table
+//! reference that replaces the call, from the plan cache when possible. If the plan had to
+//! be transformed, the resulting relation and its connection are stored in transformed.
+static shared_ptr<ConsumedSubstraitPlan> ConsumePlan(ClientContext &context, TableFunctionBindInput &input,
+                                                     const string &serialized, bool is_json,
+                                                     TransformedSubstraitPlan &transformed) {
+	auto &cache = input.info->Cast<SubstraitFunctionInfo>().consumer_cache;
+	SubstraitConsumerSettings settings(context);
+	hash_t key;
+	bool use_cache =
+	    EnablePlanCache(context, cache) && GetConsumerCacheKey(context, serialized, is_json, settings, key);
+	if (use_cache) {
+		auto cached = cache.Get(key, serialized);
+		if (cached) {
+			return cached;
+		}
 	}
-	string serialized = input.inputs[0].GetValueUnsafe<string>();
+	auto result = make_shared_ptr<ConsumedSubstraitPlan>();
+	result->plan = SubstraitToDuckDB::ParsePlan(serialized, is_json, settings.max_plan_depth);
 	// Create a new connection to avoid deadlock with the locked context
-	auto con = Connection(*context.db);
-	auto plan = SubstraitPlanToDuckDBRel(con.context, serialized, is_json);
-	if (!plan.get()->IsReadOnly()) {
-		return nullptr;
+	transformed.conn = make_uniq<Connection>(*context.db);
+	SubstraitToDuckDB transformer_s2d(transformed.conn->context, result->plan, settings);
+	transformed.relation = transformer_s2d.TransformPlan();
+	if (transformed.relation->IsReadOnly()) {
+		result->table_ref = transformed.relation->GetTableRef();
+	}
+	if (use_cache) {
+		cache.Put(key, serialized, result);
 	}
-	return plan->GetTableRef();
+	return result;
+}
+
+static unique_ptr<TableRef> SubstraitBindReplace(ClientContext &context, TableFunctionBindInput &input, bool is_json,
+                                                 bool is_file) {
+	auto &argument = GetPlanArgument(input);
+	string file_contents;
+	if (is_file) {
+		file_contents = ReadPlanFile(context, argument);
+	}
+	auto &serialized = is_file ? file_contents : argument;
+	auto transformed = make_uniq<TransformedSubstraitPlan>();
+	auto consumed = ConsumePlan(context, input, serialized, is_json, *transformed);
+	if (consumed->table_ref) {
+		return consumed->table_ref->Copy();
+	}
+	if (transformed->relation) {
+		// bind is called next, hand it the relation instead of transforming the plan (or reading the file) again
+		transformed->source_data = argument.data();
+		transformed->source_size = argument.size();
+		transformed->is_json = is_json;
+		GetBindState(context).pending = std::move(transformed);
+	}
+	return nullptr;
 }
 
 static unique_ptr<TableRef> FromSubstraitBindReplace(ClientContext &context, TableFunctionBindInput &input) {
-	return SubstraitBindReplace(context, input, false);
+	return SubstraitBindReplace(context, input, false, false);
 }
 
 static unique_ptr<TableRef> FromSubstraitBindReplaceJSON(ClientContext &context, TableFunctionBindInput &input) {
-	return SubstraitBindReplace(context, input, true);
+	return SubstraitBindReplace(context, input, true, false);
+}
+
+static unique_ptr<TableRef> FromSubstraitFileBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	return SubstraitBindReplace(context, input, false, true);
+}
+
+static unique_ptr<TableRef> FromSubstraitJSONFileBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	return SubstraitBindReplace(context, input, true, true);
 }
 
 struct FromSubstraitFunctionData : public TableFunctionData {
 	FromSubstraitFunctionData() = default;
 	shared_ptr<Relation> plan;
-	unique_ptr<QueryResult> res;
 	unique_ptr<Connection> conn;
 };
 
 static unique_ptr<FunctionData> SubstraitBind(ClientContext &context, TableFunctionBindInput &input,
-                                              vector<LogicalType> &return_types, vector<string> &names, bool is_json) {
-	auto result = make_uniq<FromSubstraitFunctionData>();
-	result->conn = make_uniq<Connection>(*context.db);
-	if (input.inputs[0].IsNull()) {
-		throw BinderException("from_substrait cannot be called with a NULL parameter");
+                                              vector<LogicalType> &return_types, vector<string> &names, bool is_json,
+                                              bool is_file) {
+	auto &argument = GetPlanArgument(input);
+	auto transformed = std::move(GetBindState(context).pending);
+	if (!transformed || !transformed->IsTransformedFrom(argument, is_json)) {
+		string file_contents;
+		if (is_file) {
+			file_contents = ReadPlanFile(context, argument);
+		}
+		auto &serialized = is_file ? file_contents : argument;
+		transformed = make_uniq<TransformedSubstraitPlan>();
+		auto consumed = ConsumePlan(context, input, serialized, is_json, *transformed);
+		if (!transformed->relation) {
+			// Use the connection's context to avoid deadlock with the locked context
+			transformed->conn = make_uniq<Connection>(*context.db);
+			SubstraitToDuckDB transformer_s2d(transformed->conn->context, consumed->plan,
+			                                  SubstraitConsumerSettings(context));
+			transformed->relation = transformer_s2d.TransformPlan();
+		}
 	}
-	string serialized = input.inputs[0].GetValueUnsafe<string>();
-	// Use the connection's context to avoid deadlock with the locked context
-	result->plan = SubstraitPlanToDuckDBRel(result->conn->context, serialized, is_json);
+	auto result = make_uniq<FromSubstraitFunctionData>();
+	result->conn = std::move(transformed->conn);
+	result->plan = std::move(transformed->relation);
 	for (auto &column : result->plan->Columns()) {
 		return_types.emplace_back(column.Type());
 		names.emplace_back(column.Name());
@@ -322,81 +724,287 @@ static unique_ptr<FunctionData> SubstraitBind(ClientContext &context, TableFunct
 
 static unique_ptr<FunctionData> FromSubstraitBind(ClientContext &context, TableFunctionBindInput &input,
                                                   vector<LogicalType> &return_types, vector<string> &names) {
-	return SubstraitBind(context, input, return_types, names, false);
+	return SubstraitBind(context, input, return_types, names, false, false);
 }
 
 static unique_ptr<FunctionData> FromSubstraitBindJSON(ClientContext &context, TableFunctionBindInput &input,
                                                       vector<LogicalType> &return_types, vector<string> &names) {
-	return SubstraitBind(context, input, return_types, names, true);
+	return SubstraitBind(context, input, return_types, names, true, false);
+}
+
+static unique_ptr<FunctionData> FromSubstraitFileBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	return SubstraitBind(context, input, return_types, names, false, true);
+}
+
+static unique_ptr<FunctionData> FromSubstraitJSONFileBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	return SubstraitBind(context, input, return_types, names, true, true);
+}
+
+//! The result of a from_substrait plan, whose chunks are handed out to all scanning threads
+struct FromSubstraitGlobalState : public GlobalTableFunctionState {
+	FromSubstraitGlobalState() = default;
+	mutex lock;
+	//! The connection the plan is executed on, kept alive while its result is streamed
+	unique_ptr<Connection> conn;
+	unique_ptr<QueryResult> res;
+	//! The batch index of the next chunk, used to preserve the order of the result
+	idx_t batch_index = 0;
+	bool finished = false;
+	idx_t max_threads = 1;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+};
+
+struct FromSubstraitLocalState : public LocalTableFunctionState {
+	//! The batch index of the chunk this thread emitted last
+	idx_t batch_index = 0;
+};
+
+static unique_ptr<GlobalTableFunctionState> FromSubInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+	auto &data = input.bind_data->CastNoConst<FromSubstraitFunctionData>();
+	auto result = make_uniq<FromSubstraitGlobalState>();
+	result->conn = make_uniq<Connection>(*context.db);
+	auto &execution_context = result->conn->context;
+	data.plan->context = make_shared_ptr<ClientContextWrapper>(execution_context);
+	// Stream the result, so only the chunks currently being fetched are held in memory
+	auto pending = execution_context->PendingQuery(data.plan, true);
+	if (pending->HasError()) {
+		pending->ThrowError();
+	}
+	result->res = pending->Execute();
+	if (result->res->HasError()) {
+		result->res->ThrowError();
+	}
+	result->max_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> FromSubInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                            GlobalTableFunctionState *global_state) {
+	return make_uniq<FromSubstraitLocalState>();
 }
 
 static void FromSubFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = data_p.bind_data->CastNoConst<FromSubstraitFunctionData>();
-	if (!data.res) {
-		auto con = Connection(*context.db);
-		data.plan->context = make_shared_ptr<ClientContextWrapper>(con.context);
-		data.res = data.plan->Execute();
+	auto &gstate = data_p.global_state->Cast<FromSubstraitGlobalState>();
+	auto &lstate = data_p.local_state->Cast<FromSubstraitLocalState>();
+	// The nested result can only be fetched from by one thread at a time, the chunks it
+	// returns are then processed by the downstream pipeline of every thread in parallel
+	lock_guard<mutex> guard(gstate.lock);
+	if (gstate.finished) {
+		return;
 	}
-	auto result_chunk = data.res->Fetch();
+	auto result_chunk = gstate.res->Fetch();
 	if (!result_chunk) {
+		gstate.finished = true;
 		return;
 	}
+	lstate.batch_index = gstate.batch_index++;
 	output.Move(*result_chunk);
 }
 
-void InitializeGetSubstrait(const Connection &con) {
+static OperatorPartitionData FromSubGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("from_substrait: partition columns are not supported");
+	}
+	return OperatorPartitionData(input.local_state->Cast<FromSubstraitLocalState>().batch_index);
+}
+
+struct PlanCacheStatsFunctionData : public TableFunctionData {
+	PlanCacheStatsFunctionData() = default;
+	//! Statistics of every plan cache, by the name of the function that uses it
+	vector<pair<string, SubstraitPlanCacheStats>> caches;
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> PlanCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("cache");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	for (auto &name : {"entries", "capacity", "hits", "misses", "evictions"}) {
+		names.emplace_back(name);
+		return_types.emplace_back(LogicalType::UBIGINT);
+	}
+	auto &info = input.info->Cast<SubstraitFunctionInfo>();
+	auto result = make_uniq<PlanCacheStatsFunctionData>();
+	result->caches.emplace_back("from_substrait", info.consumer_cache.GetStats());
+	result->caches.emplace_back("get_substrait", info.producer_cache.GetStats());
+	return std::move(result);
+}
+
+static void PlanCacheStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<PlanCacheStatsFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	idx_t row = 0;
+	for (auto &cache : data.caches) {
+		auto &stats = cache.second;
+		output.SetValue(0, row, Value(cache.first));
+		output.SetValue(1, row, Value::UBIGINT(stats.entries));
+		output.SetValue(2, row, Value::UBIGINT(stats.capacity));
+		output.SetValue(3, row, Value::UBIGINT(stats.hits));
+		output.SetValue(4, row, Value::UBIGINT(stats.misses));
+		output.SetValue(5, row, Value::UBIGINT(stats.evictions));
+		row++;
+	}
+	output.SetCardinality(row);
+	data.finished = true;
+}
+
+void InitializeGetSubstrait(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
 	auto &catalog = Catalog::GetSystemCatalog(*con.context);
 	// create the get_substrait table function that allows us to get a substrait
 	// binary from a valid SQL Query
 	TableFunction to_sub_func("get_substrait", {LogicalType::VARCHAR}, ToSubFunction, ToSubstraitBind);
 	to_sub_func.named_parameters["enable_optimizer"] = LogicalType::BOOLEAN;
 	to_sub_func.named_parameters["strict"] = LogicalType::BOOLEAN;
+	to_sub_func.named_parameters["values_spill_directory"] = LogicalType::VARCHAR;
+	to_sub_func.named_parameters["compact_in_filters"] = LogicalType::BOOLEAN;
+	to_sub_func.named_parameters["emit_statistics"] = LogicalType::BOOLEAN;
+	to_sub_func.function_info = info;
 	CreateTableFunctionInfo to_sub_info(to_sub_func);
 	catalog.CreateTableFunction(*con.context, to_sub_info);
 }
 
-void InitializeGetSubstraitJSON(const Connection &con) {
+void InitializeGetSubstraitJSON(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
 	auto &catalog = Catalog::GetSystemCatalog(*con.context);
 	// create the get_substrait table function that allows us to get a substrait
 	// JSON from a valid SQL Query
 	TableFunction get_substrait_json("get_substrait_json", {LogicalType::VARCHAR}, ToJsonFunction, ToJsonBind);
 
 	get_substrait_json.named_parameters["enable_optimizer"] = LogicalType::BOOLEAN;
+	get_substrait_json.named_parameters["values_spill_directory"] = LogicalType::VARCHAR;
+	get_substrait_json.named_parameters["compact_in_filters"] = LogicalType::BOOLEAN;
+	get_substrait_json.named_parameters["emit_statistics"] = LogicalType::BOOLEAN;
+	get_substrait_json.function_info = info;
 	CreateTableFunctionInfo get_substrait_json_info(get_substrait_json);
 	catalog.CreateTableFunction(*con.context, get_substrait_json_info);
 }
 
-void InitializeFromSubstrait(const Connection &con) {
+void InitializeGetSubstraitToFile(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
+	auto &catalog = Catalog::GetSystemCatalog(*con.context);
+	// create the get_substrait_to_file table function that writes the substrait
+	// binary of a valid SQL Query to a file
+	TableFunction to_sub_file_func("get_substrait_to_file", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+	                               ToSubFileFunction, ToSubFileBind);
+	to_sub_file_func.named_parameters["enable_optimizer"] = LogicalType::BOOLEAN;
+	to_sub_file_func.named_parameters["strict"] = LogicalType::BOOLEAN;
+	to_sub_file_func.named_parameters["values_spill_directory"] = LogicalType::VARCHAR;
+	to_sub_file_func.named_parameters["compact_in_filters"] = LogicalType::BOOLEAN;
+	to_sub_file_func.named_parameters["emit_statistics"] = LogicalType::BOOLEAN;
+	to_sub_file_func.function_info = info;
+	CreateTableFunctionInfo to_sub_file_info(to_sub_file_func);
+	catalog.CreateTableFunction(*con.context, to_sub_file_info);
+}
+
+void InitializeGetSubstraitBatch(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
+	auto &catalog = Catalog::GetSystemCatalog(*con.context);
+	// create the get_substrait_batch table in-out function that produces a substrait
+	// binary for every query of its input table
+	TableFunction to_sub_batch_func("get_substrait_batch", {LogicalType::TABLE}, nullptr, ToSubBatchBind, nullptr,
+	                                ToSubBatchInitLocal);
+	to_sub_batch_func.in_out_function = ToSubBatchFunction;
+	to_sub_batch_func.named_parameters["enable_optimizer"] = LogicalType::BOOLEAN;
+	to_sub_batch_func.named_parameters["strict"] = LogicalType::BOOLEAN;
+	to_sub_batch_func.named_parameters["values_spill_directory"] = LogicalType::VARCHAR;
+	to_sub_batch_func.named_parameters["compact_in_filters"] = LogicalType::BOOLEAN;
+	to_sub_batch_func.named_parameters["emit_statistics"] = LogicalType::BOOLEAN;
+	to_sub_batch_func.function_info = info;
+	CreateTableFunctionInfo to_sub_batch_info(to_sub_batch_func);
+	catalog.CreateTableFunction(*con.context, to_sub_batch_info);
+}
+
+void InitializeFromSubstrait(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
 	auto &catalog = Catalog::GetSystemCatalog(*con.context);
 
 	// create the from_substrait table function that allows us to get a query
 	// result from a substrait plan
-	TableFunction from_sub_func("from_substrait", {LogicalType::BLOB}, FromSubFunction, FromSubstraitBind);
+	TableFunction from_sub_func("from_substrait", {LogicalType::BLOB}, FromSubFunction, FromSubstraitBind,
+	                            FromSubInitGlobal, FromSubInitLocal);
 	from_sub_func.bind_replace = FromSubstraitBindReplace;
+	from_sub_func.get_partition_data = FromSubGetPartitionData;
+	from_sub_func.function_info = info;
 	CreateTableFunctionInfo from_sub_info(from_sub_func);
 	catalog.CreateTableFunction(*con.context, from_sub_info);
 }
 
-void InitializeFromSubstraitJSON(const Connection &con) {
+void InitializeFromSubstraitJSON(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
 	auto &catalog = Catalog::GetSystemCatalog(*con.context);
 	// create the from_substrait table function that allows us to get a query
 	// result from a substrait plan
 	TableFunction from_sub_func_json("from_substrait_json", {LogicalType::VARCHAR}, FromSubFunction,
-	                                 FromSubstraitBindJSON);
+	                                 FromSubstraitBindJSON, FromSubInitGlobal, FromSubInitLocal);
 	from_sub_func_json.bind_replace = FromSubstraitBindReplaceJSON;
+	from_sub_func_json.get_partition_data = FromSubGetPartitionData;
+	from_sub_func_json.function_info = info;
 	CreateTableFunctionInfo from_sub_info_json(from_sub_func_json);
 	catalog.CreateTableFunction(*con.context, from_sub_info_json);
 }
 
+void InitializeFromSubstraitFile(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
+	auto &catalog = Catalog::GetSystemCatalog(*con.context);
+	// create the from_substrait_file and from_substrait_json_file table functions that
+	// read the substrait plan from a file instead of taking it as a parameter
+	TableFunction from_sub_func_file("from_substrait_file", {LogicalType::VARCHAR}, FromSubFunction,
+	                                 FromSubstraitFileBind, FromSubInitGlobal, FromSubInitLocal);
+	from_sub_func_file.bind_replace = FromSubstraitFileBindReplace;
+	from_sub_func_file.get_partition_data = FromSubGetPartitionData;
+	from_sub_func_file.function_info = info;
+	CreateTableFunctionInfo from_sub_info_file(from_sub_func_file);
+	catalog.CreateTableFunction(*con.context, from_sub_info_file);
+
+	TableFunction from_sub_func_json_file("from_substrait_json_file", {LogicalType::VARCHAR}, FromSubFunction,
+	                                      FromSubstraitJSONFileBind, FromSubInitGlobal, FromSubInitLocal);
+	from_sub_func_json_file.bind_replace = FromSubstraitJSONFileBindReplace;
+	from_sub_func_json_file.get_partition_data = FromSubGetPartitionData;
+	from_sub_func_json_file.function_info = info;
+	CreateTableFunctionInfo from_sub_info_json_file(from_sub_func_json_file);
+	catalog.CreateTableFunction(*con.context, from_sub_info_json_file);
+}
+
+void InitializePlanCacheStats(const Connection &con, const shared_ptr<SubstraitFunctionInfo> &info) {
+	auto &catalog = Catalog::GetSystemCatalog(*con.context);
+	// create the substrait_plan_cache_stats table function that reports the
+	// usage of the plan caches
+	TableFunction cache_stats_func("substrait_plan_cache_stats", {}, PlanCacheStatsFunction, PlanCacheStatsBind);
+	cache_stats_func.function_info = info;
+	CreateTableFunctionInfo cache_stats_info(cache_stats_func);
+	catalog.CreateTableFunction(*con.context, cache_stats_info);
+}
+
 static void LoadInternal(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	config.AddExtensionOption(PLAN_CACHE_SIZE_SETTING,
+	                          "The maximum number of Substrait plans kept in the plan cache, 0 disables caching",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption(SubstraitToDuckDB::IN_LIST_JOIN_THRESHOLD_SETTING,
+	                          "The number of options from which from_substrait probes IN lists through a hash join, "
+	                          "0 disables this",
+	                          LogicalType::UBIGINT, Value::UBIGINT(SubstraitToDuckDB::DEFAULT_IN_LIST_JOIN_THRESHOLD));
+	config.AddExtensionOption(MAX_PLAN_DEPTH_SETTING,
+	                          "The maximum depth of nested relations and expressions when producing or consuming "
+	                          "Substrait plans, at most 2000",
+	                          LogicalType::UBIGINT, Value::UBIGINT(DEFAULT_MAX_PLAN_DEPTH), SetMaxPlanDepth);
+
 	Connection con(loader.GetDatabaseInstance());
 	con.BeginTransaction();
 
-	InitializeGetSubstrait(con);
-	InitializeGetSubstraitJSON(con);
+	auto info = make_shared_ptr<SubstraitFunctionInfo>();
+
+	InitializeGetSubstrait(con, info);
+	InitializeGetSubstraitJSON(con, info);
+	InitializeGetSubstraitToFile(con, info);
+	InitializeGetSubstraitBatch(con, info);
+
+	InitializeFromSubstrait(con, info);
+	InitializeFromSubstraitJSON(con, info);
+	InitializeFromSubstraitFile(con, info);
 
-	InitializeFromSubstrait(con);
-	InitializeFromSubstraitJSON(con);
+	InitializePlanCacheStats(con, info);
 
 	con.Commit();
 }
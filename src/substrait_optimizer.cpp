@@ -0,0 +1,204 @@
+#include "substrait_optimizer.hpp"
+
+#include "duckdb/common/enums/optimizer_type.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/build_probe_side_optimizer.hpp"
+#include "duckdb/optimizer/column_lifetime_analyzer.hpp"
+#include "duckdb/optimizer/common_aggregate_optimizer.hpp"
+#include "duckdb/optimizer/cse_optimizer.hpp"
+#include "duckdb/optimizer/cte_filter_pusher.hpp"
+#include "duckdb/optimizer/cte_inlining.hpp"
+#include "duckdb/optimizer/deliminator.hpp"
+#include "duckdb/optimizer/empty_result_pullup.hpp"
+#include "duckdb/optimizer/expression_heuristics.hpp"
+#include "duckdb/optimizer/filter_pullup.hpp"
+#include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
+#include "duckdb/optimizer/late_materialization.hpp"
+#include "duckdb/optimizer/limit_pushdown.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/optimizer/regex_range_filter.hpp"
+#include "duckdb/optimizer/remove_duplicate_groups.hpp"
+#include "duckdb/optimizer/remove_unused_columns.hpp"
+#include "duckdb/optimizer/sampling_pushdown.hpp"
+#include "duckdb/optimizer/statistics_propagator.hpp"
+#include "duckdb/optimizer/sum_rewriter.hpp"
+#include "duckdb/optimizer/topn_optimizer.hpp"
+#include "duckdb/optimizer/unnest_rewriter.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+namespace {
+
+struct SubstraitOptimizerPass {
+	OptimizerType type;
+	//! Runs the pass on the plan, nullptr for passes that are never run for Substrait
+	void (*run)(Optimizer &optimizer, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace
+
+//! The passes of Optimizer::Optimize at SUBSTRAIT_OPTIMIZER_DUCKDB_SOURCE_ID, in its order. The ones without a function
+//! are left out, they rewrite plans into operators only DuckDB understands:
+//! - IN_CLAUSE turns large IN clauses into a mark join against a ColumnDataCollection
+//! - COMPRESSED_MATERIALIZATION wraps materializing operators in DuckDB's internal compression functions
+//! - MATERIALIZED_CTE and COMMON_SUBPLAN deduplicate subplans into materialized CTEs
+//! - EXTENSION runs the optimizers of other extensions, whose operators the producer does not know
+static const SubstraitOptimizerPass SUBSTRAIT_OPTIMIZER_PASSES[] = {
+    {OptimizerType::EXPRESSION_REWRITER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) { optimizer.rewriter.VisitOperator(*plan); }},
+    {OptimizerType::CTE_INLINING,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     CTEInlining cte_inlining(optimizer);
+	     plan = cte_inlining.Optimize(std::move(plan));
+     }},
+    {OptimizerType::SUM_REWRITER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     SumRewriterOptimizer sum_rewriter(optimizer);
+	     sum_rewriter.Optimize(plan);
+     }},
+    {OptimizerType::FILTER_PULLUP,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     FilterPullup filter_pullup;
+	     plan = filter_pullup.Rewrite(std::move(plan));
+     }},
+    {OptimizerType::FILTER_PUSHDOWN,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     FilterPushdown filter_pushdown(optimizer);
+	     unordered_set<idx_t> top_bindings;
+	     filter_pushdown.CheckMarkToSemi(*plan, top_bindings);
+	     plan = filter_pushdown.Rewrite(std::move(plan));
+     }},
+    {OptimizerType::CTE_FILTER_PUSHER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     CTEFilterPusher cte_filter_pusher(optimizer);
+	     plan = cte_filter_pusher.Optimize(std::move(plan));
+     }},
+    {OptimizerType::REGEX_RANGE,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     RegexRangeFilter regex_opt;
+	     plan = regex_opt.Rewrite(std::move(plan));
+     }},
+    {OptimizerType::IN_CLAUSE, nullptr},
+    {OptimizerType::DELIMINATOR,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     Deliminator deliminator;
+	     plan = deliminator.Optimize(std::move(plan));
+     }},
+    {OptimizerType::EMPTY_RESULT_PULLUP,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     EmptyResultPullup empty_result_pullup;
+	     plan = empty_result_pullup.Optimize(std::move(plan));
+     }},
+    {OptimizerType::JOIN_ORDER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     JoinOrderOptimizer join_order(optimizer.context);
+	     plan = join_order.Optimize(std::move(plan));
+     }},
+    {OptimizerType::UNNEST_REWRITER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     UnnestRewriter unnest_rewriter;
+	     plan = unnest_rewriter.Optimize(std::move(plan));
+     }},
+    {OptimizerType::UNUSED_COLUMNS,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     RemoveUnusedColumns unused(optimizer.binder, optimizer.context, true);
+	     unused.VisitOperator(*plan);
+     }},
+    {OptimizerType::DUPLICATE_GROUPS,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     RemoveDuplicateGroups remove;
+	     remove.VisitOperator(*plan);
+     }},
+    {OptimizerType::COMMON_SUBEXPRESSIONS,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     CommonSubExpressionOptimizer cse_optimizer(optimizer.binder);
+	     cse_optimizer.VisitOperator(*plan);
+     }},
+    {OptimizerType::COLUMN_LIFETIME,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     ColumnLifetimeAnalyzer column_lifetime(optimizer, *plan, true);
+	     column_lifetime.VisitOperator(*plan);
+     }},
+    {OptimizerType::BUILD_SIDE_PROBE_SIDE,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     BuildProbeSideOptimizer build_probe_side(optimizer.context, *plan);
+	     build_probe_side.VisitOperator(*plan);
+     }},
+    {OptimizerType::LIMIT_PUSHDOWN,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     LimitPushdown limit_pushdown;
+	     plan = limit_pushdown.Optimize(std::move(plan));
+     }},
+    {OptimizerType::SAMPLING_PUSHDOWN,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     SamplingPushdown sampling_pushdown;
+	     plan = sampling_pushdown.Optimize(std::move(plan));
+     }},
+    {OptimizerType::TOP_N,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     TopN topn(optimizer.context);
+	     plan = topn.Optimize(std::move(plan));
+     }},
+    {OptimizerType::LATE_MATERIALIZATION,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     LateMaterialization late_materialization(optimizer);
+	     plan = late_materialization.Optimize(std::move(plan));
+     }},
+    {OptimizerType::STATISTICS_PROPAGATION,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     StatisticsPropagator propagator(optimizer, *plan);
+	     propagator.PropagateStatistics(plan);
+     }},
+    {OptimizerType::COMMON_AGGREGATE,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     CommonAggregateOptimizer common_aggregate;
+	     common_aggregate.VisitOperator(*plan);
+     }},
+    {OptimizerType::COLUMN_LIFETIME,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     ColumnLifetimeAnalyzer column_lifetime(optimizer, *plan, true);
+	     column_lifetime.VisitOperator(*plan);
+     }},
+    {OptimizerType::REORDER_FILTER,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     ExpressionHeuristics expression_heuristics(optimizer);
+	     plan = expression_heuristics.Rewrite(std::move(plan));
+     }},
+    {OptimizerType::JOIN_FILTER_PUSHDOWN,
+     [](Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	     JoinFilterPushdownOptimizer join_filter_pushdown(optimizer);
+	     join_filter_pushdown.VisitOperator(*plan);
+     }},
+    {OptimizerType::EXTENSION, nullptr},
+    {OptimizerType::COMPRESSED_MATERIALIZATION, nullptr},
+    {OptimizerType::MATERIALIZED_CTE, nullptr},
+    {OptimizerType::COMMON_SUBPLAN, nullptr},
+};
+
+unique_ptr<LogicalOperator> OptimizeForSubstrait(Binder &binder, ClientContext &context,
+                                                 unique_ptr<LogicalOperator> plan) {
+	Optimizer optimizer(binder, context);
+	auto &disabled_optimizers = DBConfig::GetConfig(context).options.disabled_optimizers;
+	for (auto &pass : SUBSTRAIT_OPTIMIZER_PASSES) {
+		if (!pass.run || disabled_optimizers.find(pass.type) != disabled_optimizers.end()) {
+			continue;
+		}
+		pass.run(optimizer, plan);
+	}
+	plan->ResolveOperatorTypes();
+	return plan;
+}
+
+vector<OptimizerType> GetSubstraitOptimizerTypes() {
+	vector<OptimizerType> types;
+	for (auto &pass : SUBSTRAIT_OPTIMIZER_PASSES) {
+		types.push_back(pass.type);
+	}
+	return types;
+}
+
+} // namespace duckdb
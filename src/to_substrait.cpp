@@ -3,9 +3,14 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/relation/materialized_relation.hpp"
 #include "duckdb/parser/constraints/not_null_constraint.hpp"
 #include "duckdb/planner/expression/list.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -13,17 +18,24 @@
 #include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/joinside.hpp"
 #include "duckdb/planner/operator/list.hpp"
 #include "duckdb/planner/operator/logical_set_operation.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "duckdb/storage/statistics/struct_stats.hpp"
 #include "google/protobuf/util/json_util.h"
 #include "substrait/algebra.pb.h"
 #include "substrait/plan.pb.h"
 
 namespace duckdb {
+//! Constant inputs with at least this many rows are spilled to a file, if a spill directory is set
+static constexpr idx_t VALUES_SPILL_THRESHOLD = STANDARD_VECTOR_SIZE;
+
 const std::unordered_map<std::string, std::string> DuckDBToSubstrait::function_names_remap = {
     {"mod", "modulus"},
     {"stddev", "std_dev"},
@@ -64,15 +76,21 @@ std::string &DuckDBToSubstrait::RemapFunctionName(std::string &function_name) {
 
 string DuckDBToSubstrait::SerializeToString() const {
 	string serialized;
-	if (!plan.SerializeToString(&serialized)) {
+	if (!plan->SerializeToString(&serialized)) {
 		throw InternalException("It was not possible to serialize the substrait plan");
 	}
 	return serialized;
 }
 
+void DuckDBToSubstrait::SerializeToStream(google::protobuf::io::ZeroCopyOutputStream &output) const {
+	if (!plan->SerializeToZeroCopyStream(&output)) {
+		throw InternalException("It was not possible to serialize the substrait plan");
+	}
+}
+
 string DuckDBToSubstrait::SerializeToJson() const {
 	string serialized;
-	auto success = google::protobuf::util::MessageToJsonString(plan, &serialized);
+	auto success = google::protobuf::util::MessageToJsonString(*plan, &serialized);
 	if (!success.ok()) {
 		throw InternalException("It was not possible to serialize the substrait plan");
 	}
@@ -197,15 +215,13 @@ void DuckDBToSubstrait::TransformInterval(const Value &dval, substrait::Expressi
 	auto &sval = *sexpr.mutable_literal();
 	auto months = dval.GetValue<interval_t>().months;
 	if (months != 0) {
-		auto interval_year = make_uniq<substrait::Expression_Literal_IntervalYearToMonth>();
+		auto interval_year = sval.mutable_interval_year_to_month();
 		interval_year->set_months(months);
-		sval.set_allocated_interval_year_to_month(interval_year.release());
 	} else {
-		auto interval_day = make_uniq<substrait::Expression_Literal_IntervalDayToSecond>();
+		auto interval_day = sval.mutable_interval_day_to_second();
 		interval_day->set_days(dval.GetValue<interval_t>().days);
 		interval_day->set_subseconds(dval.GetValue<interval_t>().micros);
 		interval_day->set_precision(6); // microseconds precision
-		sval.set_allocated_interval_day_to_second(interval_day.release());
 	}
 }
 
@@ -524,6 +540,32 @@ void DuckDBToSubstrait::TransformInExpression(Expression &dexpr, substrait::Expr
 	}
 }
 
+void DuckDBToSubstrait::TransformFilterCondition(Expression &dexpr, substrait::Expression &sexpr) {
+	if (!compact_in_filters || dexpr.GetExpressionType() != ExpressionType::COMPARE_IN) {
+		TransformExpr(dexpr, sexpr);
+		return;
+	}
+	// A filter drops rows whose condition is NULL, so an IN list of non NULL constants can be emitted compactly. The
+	// consumer checks the value for NULL as well, so it must not be volatile.
+	auto &in_op = dexpr.Cast<BoundOperatorExpression>();
+	if (in_op.children[0]->IsVolatile()) {
+		TransformExpr(dexpr, sexpr);
+		return;
+	}
+	vector<Value> values;
+	for (idx_t i = 1; i < in_op.children.size(); i++) {
+		auto &option = *in_op.children[i];
+		if (option.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT ||
+		    option.Cast<BoundConstantExpression>().value.IsNull()) {
+			TransformExpr(dexpr, sexpr);
+			return;
+		}
+		values.push_back(option.Cast<BoundConstantExpression>().value);
+	}
+	auto &value_type = in_op.children[0]->return_type;
+	TransformExpr(*in_op.children[0], CreateCompactInList(value_type, values, dexpr.return_type, sexpr));
+}
+
 void DuckDBToSubstrait::TransformIsNullExpression(Expression &dexpr, substrait::Expression &sexpr,
                                                   uint64_t col_offset) {
 	auto &dop = dexpr.Cast<BoundOperatorExpression>();
@@ -565,6 +607,7 @@ void DuckDBToSubstrait::TransformCoalesceExpression(Expression &dexpr, substrait
 }
 
 void DuckDBToSubstrait::TransformExpr(Expression &dexpr, substrait::Expression &sexpr, uint64_t col_offset) {
+	PlanDepthGuard depth_guard(plan_depth, max_plan_depth);
 	switch (dexpr.type) {
 	case ExpressionType::BOUND_REF:
 		TransformBoundRefExpression(dexpr, sexpr, col_offset);
@@ -622,8 +665,23 @@ uint64_t DuckDBToSubstrait::RegisterFunction(const string &name, vector<::substr
 	if (name.empty()) {
 		throw InternalException("Missing function name");
 	}
+	// The anchor only depends on the name and the argument kinds, so calls seen before are resolved from the memo
+	FunctionCallKey key;
+	auto name_id = function_name_ids.find(name);
+	if (name_id == function_name_ids.end()) {
+		name_id = function_name_ids.emplace(name, function_name_ids.size()).first;
+	}
+	key.name_id = name_id->second;
+	key.arg_kinds.reserve(args_types.size());
+	for (auto &type : args_types) {
+		key.arg_kinds.push_back(type.kind_case());
+	}
+	auto call_anchor = function_call_anchors.find(key);
+	if (call_anchor != function_call_anchors.end()) {
+		return call_anchor->second;
+	}
 	auto function = custom_functions.Get(name, args_types);
-	auto substrait_extensions = plan.mutable_extension_urns();
+	auto substrait_extensions = plan->mutable_extension_urns();
 	if (!function.IsNative()) {
 		auto extensionURN = function.GetExtensionURN();
 		auto it = extension_urn_map.find(extensionURN);
@@ -638,7 +696,7 @@ uint64_t DuckDBToSubstrait::RegisterFunction(const string &name, vector<::substr
 	}
 	if (functions_map.find(function.function.GetName()) == functions_map.end()) {
 		auto function_id = last_function_id++;
-		auto sfun = plan.add_extensions()->mutable_extension_function();
+		auto sfun = plan->add_extensions()->mutable_extension_function();
 		sfun->set_function_anchor(function_id);
 		sfun->set_name(function.function.GetName());
 		if (!function.IsNative()) {
@@ -665,7 +723,9 @@ uint64_t DuckDBToSubstrait::RegisterFunction(const string &name, vector<::substr
 		}
 		functions_map[function.function.GetName()] = function_id;
 	}
-	return functions_map[function.function.GetName()];
+	auto function_anchor = functions_map[function.function.GetName()];
+	function_call_anchors.emplace(std::move(key), function_anchor);
+	return function_anchor;
 }
 
 void DuckDBToSubstrait::CreateFieldRef(substrait::Expression *expr, uint64_t col_idx) {
@@ -696,7 +756,7 @@ void DuckDBToSubstrait::DepthFirstNamesRecurse(vector<string> &names, const Logi
 substrait::Expression *DuckDBToSubstrait::TransformIsNotNullFilter(uint64_t col_idx, const LogicalType &column_type,
                                                                    const TableFilter &dfilter,
                                                                    const LogicalType &return_type) {
-	auto s_expr = make_uniq<substrait::Expression>();
+	auto s_expr = NewMessage<substrait::Expression>();
 	auto scalar_fun = s_expr->mutable_scalar_function();
 	vector<substrait::Type> args_types;
 
@@ -706,13 +766,13 @@ substrait::Expression *DuckDBToSubstrait::TransformIsNotNullFilter(uint64_t col_
 	auto s_arg = scalar_fun->add_arguments();
 	CreateFieldRef(s_arg->mutable_value(), col_idx);
 	*scalar_fun->mutable_output_type() = DuckToSubstraitType(return_type);
-	return s_expr.release();
+	return s_expr;
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformIsNullFilter(uint64_t col_idx, const LogicalType &column_type,
                                                                 const TableFilter &dfilter,
                                                                 const LogicalType &return_type) {
-	auto s_expr = make_uniq<substrait::Expression>();
+	auto s_expr = NewMessage<substrait::Expression>();
 	auto scalar_fun = s_expr->mutable_scalar_function();
 	vector<substrait::Type> args_types;
 
@@ -722,7 +782,7 @@ substrait::Expression *DuckDBToSubstrait::TransformIsNullFilter(uint64_t col_idx
 	auto s_arg = scalar_fun->add_arguments();
 	CreateFieldRef(s_arg->mutable_value(), col_idx);
 	*scalar_fun->mutable_output_type() = DuckToSubstraitType(return_type);
-	return s_expr.release();
+	return s_expr;
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformStructExtractFilter(uint64_t col_idx, const LogicalType &column_type, const TableFilter &dfilter, const LogicalType &return_type) {
@@ -754,7 +814,7 @@ substrait::Expression *DuckDBToSubstrait::TransformConstantComparisonFilter(uint
                                                                             const LogicalType &column_type,
                                                                             const TableFilter &dfilter,
                                                                             const LogicalType &return_type) {
-	auto s_expr = make_uniq<substrait::Expression>();
+	auto s_expr = NewMessage<substrait::Expression>();
 	auto s_scalar = s_expr->mutable_scalar_function();
 	auto &constant_filter = dfilter.Cast<ConstantFilter>();
 	*s_scalar->mutable_output_type() = DuckToSubstraitType(LogicalTypeId::BOOLEAN);
@@ -796,13 +856,45 @@ substrait::Expression *DuckDBToSubstrait::TransformConstantComparisonFilter(uint
 		throw InternalException(ExpressionTypeToString(constant_filter.comparison_type));
 	}
 	s_scalar->set_function_reference(function_id);
-	return s_expr.release();
+	return s_expr;
+}
+
+substrait::Expression &DuckDBToSubstrait::CreateCompactInList(const LogicalType &value_type, const vector<Value> &values,
+                                                             const LogicalType &return_type,
+                                                             substrait::Expression &sexpr) {
+	// index_in(value, [values]) IS NOT NULL holds the values in a single list literal, instead of
+	// wrapping each of them in an expression of its own
+	auto list_type = LogicalType::LIST(value_type);
+	vector<substrait::Type> index_in_args {DuckToSubstraitType(value_type), DuckToSubstraitType(list_type)};
+	auto index_in_reference = RegisterFunction("index_in", index_in_args);
+	vector<substrait::Type> is_not_null_args {DuckToSubstraitType(LogicalType::BIGINT)};
+	auto is_not_null_reference = RegisterFunction("is_not_null", is_not_null_args);
+
+	auto scalar_fun = sexpr.mutable_scalar_function();
+	scalar_fun->set_function_reference(is_not_null_reference);
+	*scalar_fun->mutable_output_type() = DuckToSubstraitType(return_type);
+	auto index_in_fun = scalar_fun->add_arguments()->mutable_value()->mutable_scalar_function();
+	index_in_fun->set_function_reference(index_in_reference);
+	*index_in_fun->mutable_output_type() = DuckToSubstraitType(LogicalType::BIGINT);
+	auto &value = *index_in_fun->add_arguments()->mutable_value();
+	auto list = index_in_fun->add_arguments()->mutable_value()->mutable_literal()->mutable_list();
+	substrait::Expression value_expr;
+	for (auto &constant_value : values) {
+		value_expr.Clear();
+		TransformConstant(constant_value, value_expr);
+		*list->add_values() = value_expr.literal();
+	}
+	return value;
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformInFilter(uint64_t col_idx, const LogicalType &column_type,
                                                             const TableFilter &dfilter, const LogicalType &return_type) {
-	auto s_expr = make_uniq<substrait::Expression>();
+	auto s_expr = NewMessage<substrait::Expression>();
 	auto &in_filter = dfilter.Cast<InFilter>();
+	if (compact_in_filters) {
+		CreateFieldRef(&CreateCompactInList(column_type, in_filter.values, return_type, *s_expr), col_idx);
+		return s_expr;
+	}
 	auto singular_or_list = s_expr->mutable_singular_or_list();
 
 	// Set the input expression (the column being filtered)
@@ -813,7 +905,7 @@ substrait::Expression *DuckDBToSubstrait::TransformInFilter(uint64_t col_idx, co
 		TransformConstant(constant_value, *singular_or_list->add_options());
 	}
 
-	return s_expr.release();
+	return s_expr;
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformDynamicFilter(uint64_t col_idx, const LogicalType &column_type, const TableFilter &dfilter, const LogicalType &return_type) {
@@ -826,7 +918,7 @@ substrait::Expression *DuckDBToSubstrait::TransformDynamicFilter(uint64_t col_id
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformExpressionFilter(uint64_t col_idx, const LogicalType &column_type, const TableFilter &dfilter, const LogicalType &return_type) {
-	auto s_expr = make_uniq<substrait::Expression>();
+	auto s_expr = NewMessage<substrait::Expression>();
 	auto &expr_filter = dfilter.Cast<ExpressionFilter>();
 
 	// Create a proper column reference for the ToExpression method
@@ -835,7 +927,7 @@ substrait::Expression *DuckDBToSubstrait::TransformExpressionFilter(uint64_t col
 
 	// Transform the properly bound expression
 	TransformExpr(*bound_expr, *s_expr);
-	return s_expr.release();
+	return s_expr;
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformFilter(uint64_t col_idx, const LogicalType &column_type,
@@ -857,8 +949,16 @@ substrait::Expression *DuckDBToSubstrait::TransformFilter(uint64_t col_idx, cons
 		return TransformIsNotNullFilter(col_idx, column_type, dfilter, return_type);
 	case TableFilterType::IS_NULL:
 		return TransformIsNullFilter(col_idx, column_type, dfilter, return_type);
-	case TableFilterType::OPTIONAL_FILTER:
+	case TableFilterType::OPTIONAL_FILTER: {
+		// IN lists are pushed down as optional filters, the filter above the scan still checks them. They are only
+		// worth repeating in the read when they are compact
+		auto &optional_filter = dfilter.Cast<OptionalFilter>();
+		if (compact_in_filters && optional_filter.child_filter &&
+		    optional_filter.child_filter->filter_type == TableFilterType::IN_FILTER) {
+			return TransformInFilter(col_idx, column_type, *optional_filter.child_filter, return_type);
+		}
 		return nullptr;
+	}
         case TableFilterType::STRUCT_EXTRACT:
 		return TransformStructExtractFilter(col_idx, column_type, dfilter, return_type);
         default:
@@ -868,7 +968,7 @@ substrait::Expression *DuckDBToSubstrait::TransformFilter(uint64_t col_idx, cons
 }
 
 substrait::Expression *DuckDBToSubstrait::TransformJoinCond(const JoinCondition &dcond, uint64_t left_ncol) {
-	auto expr = make_uniq<substrait::Expression>();
+	auto expr = NewMessage<substrait::Expression>();
 	string join_comparision;
 	switch (dcond.comparison) {
 	case ExpressionType::COMPARE_EQUAL:
@@ -912,7 +1012,7 @@ substrait::Expression *DuckDBToSubstrait::TransformJoinCond(const JoinCondition
 	*scalar_fun->mutable_output_type() = DuckToSubstraitType(bool_type);
 	scalar_fun->set_function_reference(RegisterFunction(join_comparision, args_types));
 
-	return expr.release();
+	return expr;
 }
 
 void DuckDBToSubstrait::TransformOrder(const BoundOrderByNode &dordf, substrait::SortField &sordf) {
@@ -957,24 +1057,24 @@ substrait::Rel *DuckDBToSubstrait::TransformFilter(LogicalOperator &dop) {
 
 	auto &dfilter = dop.Cast<LogicalFilter>();
 
-	unique_ptr<substrait::Rel> res(TransformOp(*dop.children[0]));
+	auto res = TransformOp(*dop.children[0]);
 
 	if (!dfilter.expressions.empty()) {
-		auto filter = make_uniq<substrait::Rel>();
-		filter->mutable_filter()->set_allocated_input(res.release());
+		auto filter = NewMessage<substrait::Rel>();
+		filter->mutable_filter()->set_allocated_input(res);
 		filter->mutable_filter()->set_allocated_condition(
 		    CreateConjunction(dfilter.expressions, [&](const unique_ptr<Expression> &in) {
-			    auto expr = make_uniq<substrait::Expression>();
-			    TransformExpr(*in, *expr);
-			    return expr.release();
+			    auto expr = NewMessage<substrait::Expression>();
+			    TransformFilterCondition(*in, *expr);
+			    return expr;
 		    }));
 		res = std::move(filter);
 	}
 
 	if (!dfilter.projection_map.empty()) {
-		auto projection = make_uniq<substrait::Rel>();
+		auto projection = NewMessage<substrait::Rel>();
 		auto sproj = projection->mutable_project();
-		sproj->set_allocated_input(res.release());
+		sproj->set_allocated_input(res);
 		auto child_column_count = GetColumnCount(*dop.children[0]);
 		auto t_index = 0;
 		vector<int32_t> output_mapping;
@@ -987,16 +1087,16 @@ substrait::Rel *DuckDBToSubstrait::TransformFilter(LogicalOperator &dop) {
 		sproj->set_allocated_common(rel_common);
 		res = std::move(projection);
 	}
-	return res.release();
+	return res;
 }
 
 substrait::RelCommon *DuckDBToSubstrait::CreateOutputMapping(vector<int32_t> vector) {
-	auto rel_common = make_uniq<substrait::RelCommon>();
+	auto rel_common = NewMessage<substrait::RelCommon>();
 	auto output_mapping = rel_common->mutable_emit()->mutable_output_mapping();
 	for (auto &col_idx : vector) {
 		output_mapping->Add(col_idx);
 	}
-	return rel_common.release();
+	return rel_common;
 }
 
 bool DuckDBToSubstrait::IsPassthroughProjection(LogicalProjection &dproj, idx_t child_column_count,
@@ -1025,7 +1125,7 @@ bool DuckDBToSubstrait::IsPassthroughProjection(LogicalProjection &dproj, idx_t
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformProjection(LogicalOperator &dop) {
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto &dproj = dop.Cast<LogicalProjection>();
 
 	auto child_column_count = GetColumnCount(*dop.children[0]);
@@ -1061,15 +1161,15 @@ substrait::Rel *DuckDBToSubstrait::TransformProjection(LogicalOperator &dop) {
 		auto rel_common = CreateOutputMapping(output_mapping);
 		sproj->set_allocated_common(rel_common);
 	}
-	return res.release();
+	return res;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformTopN(LogicalOperator &dop) {
 	auto &dtopn = dop.Cast<LogicalTopN>();
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto stopn = res->mutable_fetch();
 
-	auto sord_rel = make_uniq<substrait::Rel>();
+	auto sord_rel = NewMessage<substrait::Rel>();
 	auto sord = sord_rel->mutable_sort();
 	sord->set_allocated_input(TransformOp(*dop.children[0]));
 
@@ -1077,19 +1177,19 @@ substrait::Rel *DuckDBToSubstrait::TransformTopN(LogicalOperator &dop) {
 		TransformOrder(dordf, *sord->add_sorts());
 	}
 
-	stopn->set_allocated_input(sord_rel.release());
+	stopn->set_allocated_input(sord_rel);
 
 	// Set offset expression (always set, default is 0)
-	auto offset_expr = make_uniq<substrait::Expression>();
+	auto offset_expr = NewMessage<substrait::Expression>();
 	offset_expr->mutable_literal()->set_i64(static_cast<int64_t>(dtopn.offset));
-	stopn->set_allocated_offset_expr(offset_expr.release());
+	stopn->set_allocated_offset_expr(offset_expr);
 
 	// Set count expression (TopN always has a limit)
-	auto count_expr = make_uniq<substrait::Expression>();
+	auto count_expr = NewMessage<substrait::Expression>();
 	count_expr->mutable_literal()->set_i64(static_cast<int64_t>(dtopn.limit));
-	stopn->set_allocated_count_expr(count_expr.release());
+	stopn->set_allocated_count_expr(count_expr);
 
-	return res.release();
+	return res;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformLimit(LogicalOperator &dop) {
@@ -1118,27 +1218,27 @@ substrait::Rel *DuckDBToSubstrait::TransformLimit(LogicalOperator &dop) {
 		throw InternalException("Unsupported offset value type");
 	}
 
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto stopn = res->mutable_fetch();
 	stopn->set_allocated_input(TransformOp(*dop.children[0]));
 
 	// Set offset expression (always set, default is 0)
-	auto offset_expr = make_uniq<substrait::Expression>();
+	auto offset_expr = NewMessage<substrait::Expression>();
 	offset_expr->mutable_literal()->set_i64(static_cast<int64_t>(offset_val));
-	stopn->set_allocated_offset_expr(offset_expr.release());
+	stopn->set_allocated_offset_expr(offset_expr);
 
 	// Set count expression only if limit is set (not -1)
 	if (limit_val >= 0) {
-		auto count_expr = make_uniq<substrait::Expression>();
+		auto count_expr = NewMessage<substrait::Expression>();
 		count_expr->mutable_literal()->set_i64(static_cast<int64_t>(limit_val));
-		stopn->set_allocated_count_expr(count_expr.release());
+		stopn->set_allocated_count_expr(count_expr);
 	}
 
-	return res.release();
+	return res;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformOrderBy(LogicalOperator &dop) {
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto &dord = dop.Cast<LogicalOrder>();
 	auto sord = res->mutable_sort();
 
@@ -1149,7 +1249,7 @@ substrait::Rel *DuckDBToSubstrait::TransformOrderBy(LogicalOperator &dop) {
 	}
 
 	if (!dord.projection_map.empty()) {
-		auto proj_rel = make_uniq<substrait::Rel>();
+		auto proj_rel = NewMessage<substrait::Rel>();
 		auto projection = proj_rel->mutable_project();
 		auto child_column_count = GetColumnCount(*dop.children[0]);
 		for (auto &col_idx : dord.projection_map) {
@@ -1161,15 +1261,15 @@ substrait::Rel *DuckDBToSubstrait::TransformOrderBy(LogicalOperator &dop) {
 		}
 		auto rel_common = CreateOutputMapping(output_mapping);
 		projection->set_allocated_common(rel_common);
-		projection->set_allocated_input(res.release());
-		return proj_rel.release();
+		projection->set_allocated_input(res);
+		return proj_rel;
 	}
 
-	return res.release();
+	return res;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformComparisonJoin(LogicalOperator &dop) {
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto sjoin = res->mutable_join();
 	auto &djoin = dop.Cast<LogicalComparisonJoin>();
 	
@@ -1244,7 +1344,7 @@ substrait::Rel *DuckDBToSubstrait::TransformComparisonJoin(LogicalOperator &dop)
 		sjoin->set_allocated_expression(CreateConjunction(
 		    djoin.conditions, [&](const JoinCondition &in) {
 				// Create expression with swapped left/right
-				auto expr = make_uniq<substrait::Expression>();
+				auto expr = NewMessage<substrait::Expression>();
 				string join_comparision;
 				switch (in.comparison) {
 				case ExpressionType::COMPARE_EQUAL:
@@ -1295,7 +1395,7 @@ substrait::Rel *DuckDBToSubstrait::TransformComparisonJoin(LogicalOperator &dop)
 				*scalar_fun->mutable_output_type() = DuckToSubstraitType(bool_type);
 				scalar_fun->set_function_reference(RegisterFunction(join_comparision, args_types));
 				
-				return expr.release();
+				return expr;
 			}));
 	} else {
 		sjoin->set_allocated_expression(CreateConjunction(
@@ -1350,7 +1450,7 @@ substrait::Rel *DuckDBToSubstrait::TransformComparisonJoin(LogicalOperator &dop)
 		}
 	}
 	// TODO this projection seems redundant but from_substrait does not work without it
-	auto proj_rel = make_uniq<substrait::Rel>();
+	auto proj_rel = NewMessage<substrait::Rel>();
 	auto projection = proj_rel->mutable_project();
 	auto child_column_count = GetColumnCount(*dop.children[left_child_idx]);
 	
@@ -1374,8 +1474,8 @@ substrait::Rel *DuckDBToSubstrait::TransformComparisonJoin(LogicalOperator &dop)
 	}
 	auto rel_common = CreateOutputMapping(output_mapping);
 	projection->set_allocated_common(rel_common);
-	projection->set_allocated_input(res.release());
-	return proj_rel.release();
+	projection->set_allocated_input(res);
+	return proj_rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformDuplicateEliminatedGet(LogicalOperator &dop) {
@@ -1408,7 +1508,7 @@ substrait::Rel *DuckDBToSubstrait::TransformDuplicateEliminatedGet(LogicalOperat
 		loaded->set_type(substrait::RelCommon_Hint_ComputationType_COMPUTATION_TYPE_HASHTABLE);
 	}
 
-	auto res = new substrait::Rel();
+	auto res = NewMessage<substrait::Rel>();
 	auto aggregate = res->mutable_aggregate();
 	aggregate->set_allocated_input(data_side);
 	auto grouping = aggregate->add_groupings();
@@ -1420,7 +1520,7 @@ substrait::Rel *DuckDBToSubstrait::TransformDuplicateEliminatedGet(LogicalOperat
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformAggregateGroup(LogicalOperator &dop) {
-	auto res = make_uniq<substrait::Rel>();
+	auto res = NewMessage<substrait::Rel>();
 	auto &daggr = dop.Cast<LogicalAggregate>();
 	auto saggr = res->mutable_aggregate();
 	saggr->set_allocated_input(TransformOp(*dop.children[0]));
@@ -1499,88 +1599,96 @@ substrait::Rel *DuckDBToSubstrait::TransformAggregateGroup(LogicalOperator &dop)
 		*smeas->mutable_output_type() = DuckToSubstraitType(LogicalType::BIGINT);
 	}
 
-	return res.release();
+	return res;
+}
+
+//! Hashes the partitions and orders of a window expression, window expressions over the same spec hash equally
+static hash_t WindowSpecHash(const BoundWindowExpression &window_expr) {
+	auto hash = Hash(window_expr.partitions.size());
+	for (auto &part : window_expr.partitions) {
+		hash = CombineHash(hash, part->Hash());
+	}
+	for (auto &order : window_expr.orders) {
+		hash = CombineHash(hash, order.expression->Hash());
+		hash = CombineHash(hash, Hash(static_cast<uint8_t>(order.type)));
+		hash = CombineHash(hash, Hash(static_cast<uint8_t>(order.null_order)));
+	}
+	return hash;
+}
+
+//! Whether two window expressions have structurally equal partitions and orders
+static bool WindowSpecEquals(const BoundWindowExpression &left, const BoundWindowExpression &right) {
+	if (left.partitions.size() != right.partitions.size() || left.orders.size() != right.orders.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < left.partitions.size(); i++) {
+		if (!left.partitions[i]->Equals(*right.partitions[i])) {
+			return false;
+		}
+	}
+	for (idx_t i = 0; i < left.orders.size(); i++) {
+		auto &left_order = left.orders[i];
+		auto &right_order = right.orders[i];
+		if (left_order.type != right_order.type || left_order.null_order != right_order.null_order ||
+		    !left_order.expression->Equals(*right_order.expression)) {
+			return false;
+		}
+	}
+	return true;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformWindow(LogicalOperator &dop) {
 	auto &dwindow = dop.Cast<LogicalWindow>();
-	
-	// Group window expressions by their partition and order specifications
-	// Key: hash of partition expressions + order expressions
-	// Value: vector of indices into dwindow.expressions
+
+	// Group window expressions by their partition and order specifications, in one pass: specs are looked up by
+	// their structural hash and only compared with the specs sharing it
 	struct WindowSpec {
-		vector<unique_ptr<Expression>> partitions;
-		vector<BoundOrderByNode> orders;
+		//! The first window expression with this spec, its partitions and orders are the ones of the group
+		BoundWindowExpression *window_expr;
 		vector<idx_t> expression_indices;
-		
-		// Helper to create a signature for comparison
-		string GetSignature() const {
-			string sig = "P:";
-			for (auto &part : partitions) {
-				sig += part->ToString() + ";";
-			}
-			sig += "O:";
-			for (auto &order : orders) {
-				sig += order.expression->ToString() + ":" +
-				       (order.type == OrderType::ASCENDING ? "ASC" : "DESC") + ";";
-			}
-			return sig;
-		}
 	};
-	
 	vector<WindowSpec> window_specs;
-	
-	// Group expressions by their window specifications
+	unordered_map<hash_t, vector<idx_t>> specs_by_hash;
+
 	for (idx_t i = 0; i < dwindow.expressions.size(); i++) {
 		auto &dexpr = dwindow.expressions[i];
 		if (dexpr->GetExpressionClass() != ExpressionClass::BOUND_WINDOW) {
 			throw NotImplementedException("Only window expressions are supported in window operator");
 		}
-		
 		auto &dwin_expr = dexpr->Cast<BoundWindowExpression>();
-		
-		// Create a spec for this expression
-		WindowSpec current_spec;
-		for (auto &part : dwin_expr.partitions) {
-			current_spec.partitions.push_back(part->Copy());
-		}
-		for (auto &order : dwin_expr.orders) {
-			current_spec.orders.push_back(order.Copy());
-		}
-		
-		// Find if we already have this spec
+
+		auto &candidates = specs_by_hash[WindowSpecHash(dwin_expr)];
 		bool found = false;
-		for (auto &spec : window_specs) {
-			if (spec.GetSignature() == current_spec.GetSignature()) {
-				spec.expression_indices.push_back(i);
+		for (auto spec_idx : candidates) {
+			if (WindowSpecEquals(*window_specs[spec_idx].window_expr, dwin_expr)) {
+				window_specs[spec_idx].expression_indices.push_back(i);
 				found = true;
 				break;
 			}
 		}
-		
 		if (!found) {
-			current_spec.expression_indices.push_back(i);
-			window_specs.push_back(std::move(current_spec));
+			candidates.push_back(window_specs.size());
+			window_specs.push_back(WindowSpec {&dwin_expr, {i}});
 		}
 	}
-	
+
 	// Now create chained window relations, one for each unique spec
 	substrait::Rel *current_input = TransformOp(*dop.children[0]);
 	
 	for (auto &spec : window_specs) {
-		auto res = make_uniq<substrait::Rel>();
+		auto res = NewMessage<substrait::Rel>();
 		auto swindow = res->mutable_window();
 		
 		// Set the input (either the original input or the previous window relation)
 		swindow->set_allocated_input(current_input);
 		
 		// Set partition expressions at relation level
-		for (auto &dpart : spec.partitions) {
+		for (auto &dpart : spec.window_expr->partitions) {
 			TransformExpr(*dpart, *swindow->add_partition_expressions());
 		}
 		
 		// Set sort specifications at relation level
-		for (auto &dorder : spec.orders) {
+		for (auto &dorder : spec.window_expr->orders) {
 			TransformOrder(dorder, *swindow->add_sorts());
 		}
 		
@@ -1784,7 +1892,7 @@ substrait::Rel *DuckDBToSubstrait::TransformWindow(LogicalOperator &dop) {
 		}
 		
 		// Update current_input to chain the next window relation
-		current_input = res.release();
+		current_input = res;
 	}
 	
 	// Return the last window relation in the chain
@@ -1806,8 +1914,18 @@ int32_t GetTimestampPrecision(LogicalTypeId type) {
 	}
 }
 
-substrait::Type DuckDBToSubstrait::DuckToSubstraitType(const LogicalType &type, BaseStatistics *column_statistics,
-                                                       bool not_null) {
+const substrait::Type &DuckDBToSubstrait::DuckToSubstraitType(const LogicalType &type,
+                                                               BaseStatistics *column_statistics, bool not_null) const {
+	// Column statistics don't change the Substrait type, so they are not part of the cache key
+	auto &types = not_null ? required_types : nullable_types;
+	auto entry = types.find(type);
+	if (entry == types.end()) {
+		entry = types.emplace(type, CreateSubstraitType(type, not_null)).first;
+	}
+	return entry->second;
+}
+
+substrait::Type DuckDBToSubstrait::CreateSubstraitType(const LogicalType &type, bool not_null) {
 	substrait::Type s_type;
 	substrait::Type_Nullability type_nullability;
 	if (not_null) {
@@ -1934,7 +2052,7 @@ substrait::Type DuckDBToSubstrait::DuckToSubstraitType(const LogicalType &type,
 		auto children = StructType::GetChildTypes(type);
 		for (auto &child : children) {
 			auto new_type = struct_type->add_types();
-			*new_type = DuckToSubstraitType(child.second, column_statistics, not_null);
+			*new_type = CreateSubstraitType(child.second, not_null);
 		}
 		return s_type;
 	}
@@ -1945,8 +2063,8 @@ substrait::Type DuckDBToSubstrait::DuckToSubstraitType(const LogicalType &type,
 		auto key_type = MapType::KeyType(type);
 		auto value_type = MapType::ValueType(type);
 
-		*map_type->mutable_key() = DuckToSubstraitType(key_type, column_statistics, not_null);
-		*map_type->mutable_value() = DuckToSubstraitType(value_type, column_statistics, not_null);
+		*map_type->mutable_key() = CreateSubstraitType(key_type, not_null);
+		*map_type->mutable_value() = CreateSubstraitType(value_type, not_null);
 
 		return s_type;
 	}
@@ -1956,7 +2074,7 @@ substrait::Type DuckDBToSubstrait::DuckToSubstraitType(const LogicalType &type,
 
 		auto child_type = ListType::GetChildType(type);
 
-		*list_type->mutable_type() = DuckToSubstraitType(child_type, column_statistics, not_null);
+		*list_type->mutable_type() = CreateSubstraitType(child_type, not_null);
 
 		return s_type;
 	}
@@ -1993,8 +2111,8 @@ void DuckDBToSubstrait::TransformTableScanToSubstrait(LogicalGet &dget, substrai
 	auto &table_scan_bind_data = dget.bind_data->Cast<TableScanBindData>();
 	auto &table = table_scan_bind_data.table;
 	sget->mutable_named_table()->add_names(table.name);
-	auto base_schema = make_uniq<substrait::NamedStruct>();
-	auto type_info = make_uniq<substrait::Type_Struct>();
+	auto base_schema = sget->mutable_base_schema();
+	auto type_info = base_schema->mutable_struct_();
 	type_info->set_nullability(substrait::Type_Nullability_NULLABILITY_REQUIRED);
 	auto not_null_constraint = GetNotNullConstraintCol(table);
 	for (idx_t i = 0; i < dget.names.size(); i++) {
@@ -2009,8 +2127,6 @@ void DuckDBToSubstrait::TransformTableScanToSubstrait(LogicalGet &dget, substrai
 		auto new_type = type_info->add_types();
 		*new_type = DuckToSubstraitType(cur_type, column_statistics.get(), not_null);
 	}
-	base_schema->set_allocated_struct_(type_info.release());
-	sget->set_allocated_base_schema(base_schema.release());
 }
 
 void DuckDBToSubstrait::TransformParquetScanToSubstrait(LogicalGet &dget, substrait::ReadRel *sget, BindInfo &bind_info,
@@ -2023,8 +2139,8 @@ void DuckDBToSubstrait::TransformParquetScanToSubstrait(LogicalGet &dget, substr
 		parquet_item->mutable_parquet();
 	}
 
-	auto base_schema = make_uniq<substrait::NamedStruct>();
-	auto type_info = make_uniq<substrait::Type_Struct>();
+	auto base_schema = sget->mutable_base_schema();
+	auto type_info = base_schema->mutable_struct_();
 	type_info->set_nullability(substrait::Type_Nullability_NULLABILITY_REQUIRED);
 	for (idx_t i = 0; i < dget.names.size(); i++) {
 		auto cur_type = dget.returned_types[i];
@@ -2037,13 +2153,11 @@ void DuckDBToSubstrait::TransformParquetScanToSubstrait(LogicalGet &dget, substr
 		auto new_type = type_info->add_types();
 		*new_type = DuckToSubstraitType(cur_type, column_statistics.get(), false);
 	}
-	base_schema->set_allocated_struct_(type_info.release());
-	sget->set_allocated_base_schema(base_schema.release());
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformDummyScan() {
 	// I just have to turn the dummy scan to emit one garbage row, the projection will take care of the rest
-	auto get_rel = make_uniq<substrait::Rel>();
+	auto get_rel = NewMessage<substrait::Rel>();
 	auto sget = get_rel->mutable_read();
 	auto virtual_table = sget->mutable_virtual_table();
 
@@ -2051,21 +2165,21 @@ substrait::Rel *DuckDBToSubstrait::TransformDummyScan() {
 	auto dummy_struct = virtual_table->add_expressions();
 	auto dummy_field = dummy_struct->add_fields();
 	dummy_field->mutable_literal()->set_i32(42);
-	return get_rel.release();
+	return get_rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformEmptyResult(LogicalOperator &dop) {
 	// Create an empty virtual table to represent an empty result
 	// An empty virtual table (no rows) naturally represents an empty result
-	auto get_rel = make_uniq<substrait::Rel>();
+	auto get_rel = NewMessage<substrait::Rel>();
 	auto sget = get_rel->mutable_read();
 	sget->mutable_virtual_table();
 	// Don't add any expressions - this creates an empty virtual table with no rows
 
 	// Add base_schema to preserve the schema information
 	auto &empty_result = dop.Cast<LogicalEmptyResult>();
-	auto base_schema = make_uniq<substrait::NamedStruct>();
-	auto type_info = make_uniq<substrait::Type_Struct>();
+	auto base_schema = sget->mutable_base_schema();
+	auto type_info = base_schema->mutable_struct_();
 	type_info->set_nullability(substrait::Type_Nullability_NULLABILITY_REQUIRED);
 	
 	for (idx_t i = 0; i < empty_result.return_types.size(); i++) {
@@ -2079,14 +2193,12 @@ substrait::Rel *DuckDBToSubstrait::TransformEmptyResult(LogicalOperator &dop) {
 		auto new_type = type_info->add_types();
 		*new_type = DuckToSubstraitType(cur_type, nullptr, false);
 	}
-	base_schema->set_allocated_struct_(type_info.release());
-	sget->set_allocated_base_schema(base_schema.release());
 
-	return get_rel.release();
+	return get_rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformGet(LogicalOperator &dop) {
-	auto get_rel = make_uniq<substrait::Rel>();
+	auto get_rel = NewMessage<substrait::Rel>();
 	auto &dget = dop.Cast<LogicalGet>();
 
 	if (!dget.function.get_bind_info) {
@@ -2156,16 +2268,16 @@ substrait::Rel *DuckDBToSubstrait::TransformGet(LogicalOperator &dop) {
 			output_positions.push_back(read_position(column->GetPrimaryIndex()));
 		}
 
-		auto projection = make_uniq<substrait::Expression_MaskExpression>();
+		auto projection = NewMessage<substrait::Expression_MaskExpression>();
 		projection->set_maintain_singular_struct(true);
 		auto select = projection->mutable_select();
 		for (auto col_idx : read_columns) {
 			auto struct_item = select->add_struct_items();
 			struct_item->set_field(static_cast<int32_t>(col_idx));
 		}
-		sget->set_allocated_projection(projection.release());
+		sget->set_allocated_projection(projection);
 	} else if (!output_columns.empty()) {
-		auto projection = make_uniq<substrait::Expression_MaskExpression>();
+		auto projection = NewMessage<substrait::Expression_MaskExpression>();
 		// fixme: whatever this means
 		projection->set_maintain_singular_struct(true);
 		auto select = projection->mutable_select();
@@ -2191,7 +2303,7 @@ substrait::Rel *DuckDBToSubstrait::TransformGet(LogicalOperator &dop) {
 			}
 		}
 		if (select->struct_items_size() != 0) {
-			sget->set_allocated_projection(projection.release());
+			sget->set_allocated_projection(projection);
 		}
 	}
 
@@ -2230,9 +2342,9 @@ substrait::Rel *DuckDBToSubstrait::TransformGet(LogicalOperator &dop) {
 
 		// Wrap the read in a projection performing the struct extraction the scan
 		// would have done, emitting only the extracted values.
-		auto proj_rel = make_uniq<substrait::Rel>();
+		auto proj_rel = NewMessage<substrait::Rel>();
 		auto sproj = proj_rel->mutable_project();
-		sproj->set_allocated_input(get_rel.release());
+		sproj->set_allocated_input(get_rel);
 		vector<int32_t> output_mapping;
 		auto read_column_count = static_cast<int32_t>(read_columns.size());
 		for (idx_t i = 0; i < output_columns.size(); i++) {
@@ -2247,15 +2359,21 @@ substrait::Rel *DuckDBToSubstrait::TransformGet(LogicalOperator &dop) {
 			output_mapping.push_back(read_column_count + static_cast<int32_t>(i));
 		}
 		sproj->set_allocated_common(CreateOutputMapping(output_mapping));
-		return proj_rel.release();
+		return proj_rel;
 	}
 
-	return get_rel.release();
+	return get_rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformExpressionGet(LogicalOperator &dop) {
-	auto get_rel = make_uniq<substrait::Rel>();
 	auto &dget = dop.Cast<LogicalExpressionGet>();
+	if (!values_spill_directory.empty() && dget.expressions.size() >= VALUES_SPILL_THRESHOLD) {
+		auto spilled_rel = SpillExpressionGet(dop);
+		if (spilled_rel) {
+			return spilled_rel;
+		}
+	}
+	auto get_rel = NewMessage<substrait::Rel>();
 
 	auto sget = get_rel->mutable_read();
 	auto virtual_table = sget->mutable_virtual_table();
@@ -2266,21 +2384,133 @@ substrait::Rel *DuckDBToSubstrait::TransformExpressionGet(LogicalOperator &dop)
 			TransformExpr(*expr, *row_item->add_fields());
 		}
 	}
-	return get_rel.release();
+	return get_rel;
+}
+
+//! Whether values of the type read back from a Parquet file exactly as they were written. Other types are written
+//! as a different type (HUGEINT, ENUM), or lose precision or offsets (INTERVAL, TIME_TZ), and would not match the
+//! base schema of the read
+static bool RoundTripsThroughParquet(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return true;
+	case LogicalTypeId::LIST:
+		return RoundTripsThroughParquet(ListType::GetChildType(type));
+	case LogicalTypeId::STRUCT:
+		for (auto &child : StructType::GetChildTypes(type)) {
+			if (!RoundTripsThroughParquet(child.second)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+substrait::Rel *DuckDBToSubstrait::SpillExpressionGet(LogicalOperator &dop) {
+	auto &dget = dop.Cast<LogicalExpressionGet>();
+	hash_t content_hash = 0;
+	for (auto &type : dget.expr_types) {
+		if (!RoundTripsThroughParquet(type)) {
+			return nullptr;
+		}
+		content_hash = CombineHash(content_hash, Hash(type.ToString().c_str()));
+	}
+	auto collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), dget.expr_types);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), dget.expr_types);
+	for (auto &row : dget.expressions) {
+		auto row_idx = chunk.size();
+		for (idx_t col_idx = 0; col_idx < row.size(); col_idx++) {
+			if (row[col_idx]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+				// Only constant inputs can be written out, anything else is inlined as usual
+				return nullptr;
+			}
+			auto &value = row[col_idx]->Cast<BoundConstantExpression>().value;
+			content_hash = CombineHash(content_hash, value.Hash());
+			chunk.SetValue(col_idx, row_idx, value);
+		}
+		chunk.SetCardinality(row_idx + 1);
+		if (chunk.size() == STANDARD_VECTOR_SIZE) {
+			collection->Append(chunk);
+			chunk.Reset();
+		}
+	}
+	if (chunk.size() > 0) {
+		collection->Append(chunk);
+	}
+
+	vector<string> names;
+	for (idx_t col_idx = 0; col_idx < dget.expr_types.size(); col_idx++) {
+		names.push_back("col" + to_string(col_idx));
+	}
+	// Files are named after their contents, so producing a plan for the same input again reuses the file
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto file_name = "values_" + to_string(dget.expressions.size()) + "_" + to_string(content_hash) + ".parquet";
+	auto file_path = fs.JoinPath(values_spill_directory, file_name);
+	if (!fs.FileExists(file_path)) {
+		// The context is busy producing this plan, the file is written through a connection of its own. It is
+		// written under a temporary name first, so a plan produced concurrently never reads a partial file.
+		if (!spill_connection) {
+			spill_connection = make_uniq<Connection>(*context.db);
+		}
+		auto values_rel =
+		    make_shared_ptr<MaterializedRelation>(spill_connection->context, std::move(collection), names);
+		auto temp_path = fs.JoinPath(values_spill_directory, file_name + "." + StringUtil::GenerateRandomName());
+		values_rel->WriteParquet(temp_path);
+		fs.MoveFile(temp_path, file_path);
+	}
+
+	auto get_rel = NewMessage<substrait::Rel>();
+	auto sget = get_rel->mutable_read();
+	auto file_item = sget->mutable_local_files()->add_items();
+	file_item->set_uri_file(file_path);
+	file_item->mutable_parquet();
+
+	auto base_schema = sget->mutable_base_schema();
+	auto type_info = base_schema->mutable_struct_();
+	type_info->set_nullability(substrait::Type_Nullability_NULLABILITY_REQUIRED);
+	for (idx_t col_idx = 0; col_idx < dget.expr_types.size(); col_idx++) {
+		auto &type = dget.expr_types[col_idx];
+		base_schema->add_names(names[col_idx]);
+		for (auto &name : DepthFirstNames(type)) {
+			base_schema->add_names(name);
+		}
+		*type_info->add_types() = DuckToSubstraitType(type);
+	}
+	return get_rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformCrossProduct(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto sub_cross_prod = rel->mutable_cross();
 	auto &djoin = dop.Cast<LogicalCrossProduct>();
 	sub_cross_prod->set_allocated_left(TransformOp(*dop.children[0]));
 	sub_cross_prod->set_allocated_right(TransformOp(*dop.children[1]));
 	auto bindings = djoin.GetColumnBindings();
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformUnion(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 
 	auto set_op = rel->mutable_set();
 	auto &dunion = dop.Cast<LogicalSetOperation>();
@@ -2294,19 +2524,19 @@ substrait::Rel *DuckDBToSubstrait::TransformUnion(LogicalOperator &dop) {
 		inputs->AddAllocated(TransformOp(*child));
 	}
 	auto bindings = dunion.GetColumnBindings();
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::CreateSetOperation(LogicalOperator &child_op,
                                                        substrait::SetRel_SetOp set_op_type) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto set_op = rel->mutable_set();
 	set_op->set_op(set_op_type);
 	auto &set_operation = child_op.Cast<LogicalSetOperation>();
 	auto inputs = set_op->mutable_inputs();
 	inputs->AddAllocated(TransformOp(*set_operation.children[0]));
 	inputs->AddAllocated(TransformOp(*set_operation.children[1]));
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformDistinct(LogicalOperator &dop) {
@@ -2325,7 +2555,7 @@ substrait::Rel *DuckDBToSubstrait::TransformDistinct(LogicalOperator &dop) {
 	default: {
 		// Standalone DISTINCT operation - use AggregateRel with grouping but no measures
 		// This handles cases like: SELECT DISTINCT col1, col2 FROM table
-		auto rel = make_uniq<substrait::Rel>();
+		auto rel = NewMessage<substrait::Rel>();
 		auto saggr = rel->mutable_aggregate();
 		
 		// Set the input relation
@@ -2349,13 +2579,13 @@ substrait::Rel *DuckDBToSubstrait::TransformDistinct(LogicalOperator &dop) {
 		}
 		
 		// No measures needed for DISTINCT - it's just grouping
-		return rel.release();
+		return rel;
 	}
 	}
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformExcept(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto set_op = rel->mutable_set();
 	set_op->set_op(substrait::SetRel_SetOp::SetRel_SetOp_SET_OP_MINUS_PRIMARY);
 	auto &set_operation = dop.Cast<LogicalSetOperation>();
@@ -2366,7 +2596,7 @@ substrait::Rel *DuckDBToSubstrait::TransformExcept(LogicalOperator &dop) {
 		inputs->AddAllocated(TransformOp(*child));
 	}
 	auto bindings = dop.GetColumnBindings();
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformIntersect(LogicalOperator &dop) {
@@ -2378,18 +2608,18 @@ substrait::Rel *DuckDBToSubstrait::TransformIntersect(LogicalOperator &dop) {
 		throw NotImplementedException("INTERSECT with more than two children is not yet supported in the "
 		                              "to_substrait function");
 	}
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto set_op = rel->mutable_set();
 	set_op->set_op(substrait::SetRel_SetOp::SetRel_SetOp_SET_OP_INTERSECTION_PRIMARY);
 	auto inputs = set_op->mutable_inputs();
 	inputs->AddAllocated(TransformOp(*set_operation.children[0]));
 	inputs->AddAllocated(TransformOp(*set_operation.children[1]));
 	auto bindings = dop.GetColumnBindings();
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformCreateTable(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto &create_table = dop.Cast<LogicalCreateTable>();
 	auto &create_info = create_table.info.get()->Base();
 	if (create_table.children.size() != 1) {
@@ -2399,41 +2629,38 @@ substrait::Rel *DuckDBToSubstrait::TransformCreateTable(LogicalOperator &dop) {
 		throw InternalException("Create table with more than one child is not supported");
 	}
 
-	auto schema = make_uniq<substrait::NamedStruct>();
-	auto type_info = make_uniq<substrait::Type_Struct>();
+	auto schema = NewMessage<substrait::NamedStruct>();
+	auto type_info = NewMessage<substrait::Type_Struct>();
 	for (auto &name : create_info.columns.GetColumnNames()) {
 		schema->add_names(name);
 	}
 	for (auto &col_type : create_info.columns.GetColumnTypes()) {
-		auto s_type = DuckToSubstraitType(col_type, nullptr, false);
-		*type_info->add_types() = s_type;
+		*type_info->add_types() = DuckToSubstraitType(col_type, nullptr, false);
 	}
-	schema->set_allocated_struct_(type_info.release());
+	schema->set_allocated_struct_(type_info);
 
 	// This is CreateTableAsSelect
 	substrait::Rel *input = TransformOp(*create_table.children[0]);
 	auto write = rel->mutable_write();
-	write->set_allocated_table_schema(schema.release());
+	write->set_allocated_table_schema(schema);
 	write->set_allocated_input(input);
 	write->set_op(substrait::WriteRel::WriteOp::WriteRel_WriteOp_WRITE_OP_CTAS);
 	auto named_table = write->mutable_named_table();
 	named_table->add_names(create_info.schema);
 	named_table->add_names(create_info.table);
 
-	return rel.release();
+	return rel;
 }
 
-void DuckDBToSubstrait::SetTableSchema(const TableCatalogEntry &table, substrait::NamedStruct *schema) {
+void DuckDBToSubstrait::SetTableSchema(const TableCatalogEntry &table, substrait::NamedStruct *schema) const {
 	for (auto &name : table.GetColumns().GetColumnNames()) {
 		schema->add_names(name);
 	}
-	auto type_info = make_uniq<substrait::Type_Struct>();
+	auto type_info = schema->mutable_struct_();
 	type_info->set_nullability(substrait::Type_Nullability_NULLABILITY_REQUIRED);
 	for (auto &col_type : table.GetColumns().GetColumnTypes()) {
-		auto s_type = DuckToSubstraitType(col_type, nullptr, false);
-		*type_info->add_types() = s_type;
+		*type_info->add_types() = DuckToSubstraitType(col_type, nullptr, false);
 	}
-	schema->set_allocated_struct_(type_info.release());
 }
 
 void DuckDBToSubstrait::SetNamedTable(const TableCatalogEntry &table, substrait::WriteRel *writeRel) {
@@ -2443,7 +2670,7 @@ void DuckDBToSubstrait::SetNamedTable(const TableCatalogEntry &table, substrait:
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformInsertTable(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto &insert_table = dop.Cast<LogicalInsert>();
 	if (insert_table.children.size() != 1) {
 		throw InternalException("insert table expected one child, found " + to_string(insert_table.children.size()));
@@ -2454,17 +2681,15 @@ substrait::Rel *DuckDBToSubstrait::TransformInsertTable(LogicalOperator &dop) {
 	writeRel->set_output(substrait::WriteRel::OUTPUT_MODE_NO_OUTPUT);
 
 	SetNamedTable(insert_table.table, writeRel);
-	auto schema = make_uniq<substrait::NamedStruct>();
-	SetTableSchema(insert_table.table, schema.get());
-	writeRel->set_allocated_table_schema(schema.release());
+	SetTableSchema(insert_table.table, writeRel->mutable_table_schema());
 
 	substrait::Rel *input = TransformOp(*insert_table.children[0]);
 	writeRel->set_allocated_input(input);
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformDeleteTable(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto &logical_delete = dop.Cast<LogicalDelete>();
 	auto &table = logical_delete.table;
 	if (logical_delete.children.size() != 1) {
@@ -2481,17 +2706,15 @@ substrait::Rel *DuckDBToSubstrait::TransformDeleteTable(LogicalOperator &dop) {
 	named_table->add_names(table.name);
 
 	SetNamedTable(logical_delete.table, writeRel);
-	auto schema = make_uniq<substrait::NamedStruct>();
-	SetTableSchema(logical_delete.table, schema.get());
-	writeRel->set_allocated_table_schema(schema.release());
+	SetTableSchema(logical_delete.table, writeRel->mutable_table_schema());
 
 	substrait::Rel *input = TransformOp(*logical_delete.children[0]);
 	writeRel->set_allocated_input(input);
-	return rel.release();
+	return rel;
 }
 
 substrait::Rel *DuckDBToSubstrait::TransformCTERef(LogicalOperator &dop) {
-	auto rel = make_uniq<substrait::Rel>();
+	auto rel = NewMessage<substrait::Rel>();
 	auto &cte_ref = dop.Cast<LogicalCTERef>();
 	auto it = find(cte_indices.begin(), cte_indices.end(), cte_ref.cte_index);
 	if (it == cte_indices.end()) {
@@ -2500,7 +2723,7 @@ substrait::Rel *DuckDBToSubstrait::TransformCTERef(LogicalOperator &dop) {
 	auto index = it - cte_indices.begin();
 	auto ref_rel = rel->mutable_reference();
 	ref_rel->set_subtree_ordinal(index);
-	return rel.release();
+	return rel;
 }
 
 vector<LogicalType>::size_type DuckDBToSubstrait::GetColumnCount(LogicalOperator &dop) {
@@ -2534,7 +2757,103 @@ substrait::RelCommon *DuckDBToSubstrait::GetRelCommon(substrait::Rel &rel) {
 	}
 }
 
+//! Width of a string whose statistics do not know its length, the size DuckDB stores a string value in
+static constexpr idx_t DEFAULT_STRING_WIDTH = sizeof(string_t);
+
+//! Estimates the width of a value in bytes. Strings are as wide as their maximum length if statistics
+//! know it, structs are as wide as their fields together.
+static idx_t EstimateValueWidth(const LogicalType &type, const BaseStatistics *stats) {
+	switch (type.InternalType()) {
+	case PhysicalType::VARCHAR:
+		if (stats && stats->GetStatsType() == StatisticsType::STRING_STATS && StringStats::HasMaxStringLength(*stats)) {
+			return StringStats::MaxStringLength(*stats);
+		}
+		return DEFAULT_STRING_WIDTH;
+	case PhysicalType::STRUCT: {
+		bool has_child_stats = stats && stats->GetStatsType() == StatisticsType::STRUCT_STATS;
+		auto &child_types = StructType::GetChildTypes(type);
+		idx_t width = 0;
+		for (idx_t child_idx = 0; child_idx < child_types.size(); child_idx++) {
+			auto child_stats = has_child_stats ? &StructStats::GetChildStats(*stats, child_idx) : nullptr;
+			width += EstimateValueWidth(child_types[child_idx].second, child_stats);
+		}
+		return width;
+	}
+	default:
+		return GetTypeIdSize(type.InternalType());
+	}
+}
+
+//! Returns the input of a relation with a single one, nullptr for any other relation
+static substrait::Rel *GetSingleInput(substrait::Rel &rel) {
+	switch (rel.rel_type_case()) {
+	case substrait::Rel::RelTypeCase::kFilter:
+		return rel.filter().has_input() ? rel.mutable_filter()->mutable_input() : nullptr;
+	case substrait::Rel::RelTypeCase::kFetch:
+		return rel.fetch().has_input() ? rel.mutable_fetch()->mutable_input() : nullptr;
+	case substrait::Rel::RelTypeCase::kAggregate:
+		return rel.aggregate().has_input() ? rel.mutable_aggregate()->mutable_input() : nullptr;
+	case substrait::Rel::RelTypeCase::kSort:
+		return rel.sort().has_input() ? rel.mutable_sort()->mutable_input() : nullptr;
+	case substrait::Rel::RelTypeCase::kProject:
+		return rel.project().has_input() ? rel.mutable_project()->mutable_input() : nullptr;
+	case substrait::Rel::RelTypeCase::kWindow:
+		return rel.window().has_input() ? rel.mutable_window()->mutable_input() : nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+void DuckDBToSubstrait::SetStatisticsHint(LogicalOperator &dop, substrait::Rel &rel) {
+	if (!GetRelCommon(rel)) {
+		return;
+	}
+	// Only scans know the statistics of their columns, every other operator is estimated by its types
+	vector<unique_ptr<BaseStatistics>> column_statistics(dop.types.size());
+	if (dop.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &dget = dop.Cast<LogicalGet>();
+		auto &column_ids = dget.GetColumnIds();
+		for (idx_t col_idx = 0; col_idx < dop.types.size(); col_idx++) {
+			auto column_idx = dget.projection_ids.empty() ? col_idx : dget.projection_ids[col_idx];
+			if (column_idx >= column_ids.size()) {
+				continue;
+			}
+			auto &column_id = column_ids[column_idx];
+			if (column_id.IsRowIdColumn() || column_id.IsPushdownExtract()) {
+				continue;
+			}
+			column_statistics[col_idx] =
+			    GetColumnStatistics(context, dget.function, dget.bind_data.get(), column_id.GetPrimaryIndex());
+		}
+	}
+	idx_t record_size = 0;
+	for (idx_t col_idx = 0; col_idx < dop.types.size(); col_idx++) {
+		record_size += EstimateValueWidth(dop.types[col_idx], column_statistics[col_idx].get());
+	}
+	auto row_count = static_cast<double>(dop.EstimateCardinality(context));
+	// An operator can be transformed into several relations (e.g. a read wrapped in a projection), they all share its
+	// estimates. The relations of its children already carry their own.
+	for (auto current = &rel; current; current = GetSingleInput(*current)) {
+		auto common = GetRelCommon(*current);
+		if (!common || common->hint().has_stats()) {
+			break;
+		}
+		auto stats = common->mutable_hint()->mutable_stats();
+		stats->set_row_count(row_count);
+		stats->set_record_size(static_cast<double>(record_size));
+	}
+}
+
 substrait::Rel *DuckDBToSubstrait::TransformOp(LogicalOperator &dop) {
+	PlanDepthGuard depth_guard(plan_depth, max_plan_depth);
+	auto rel = TransformOperator(dop);
+	if (emit_statistics) {
+		SetStatisticsHint(dop, *rel);
+	}
+	return rel;
+}
+
+substrait::Rel *DuckDBToSubstrait::TransformOperator(LogicalOperator &dop) {
 	switch (dop.type) {
 	case LogicalOperatorType::LOGICAL_FILTER:
 		return TransformFilter(dop);
@@ -2601,11 +2920,11 @@ static bool IsRowModificationOperator(const LogicalOperator &op) {
 }
 
 substrait::RelRoot *DuckDBToSubstrait::TransformRootOp(LogicalOperator &dop) {
-	auto root_rel = make_uniq<substrait::RelRoot>();
+	auto root_rel = NewMessage<substrait::RelRoot>();
 	root_rel->set_allocated_input(TransformOp(dop));
 
 	if (IsRowModificationOperator(dop)) {
-		return root_rel.release();
+		return root_rel;
 	}
 
 	if (dop.type == LogicalOperatorType::LOGICAL_CREATE_TABLE) {
@@ -2631,7 +2950,7 @@ substrait::RelRoot *DuckDBToSubstrait::TransformRootOp(LogicalOperator &dop) {
 		}
 	}
 
-	return root_rel.release();
+	return root_rel;
 }
 
 LogicalOperator *DuckDBToSubstrait::TransformCTE(LogicalMaterializedCTE &dop) {
@@ -2639,7 +2958,7 @@ LogicalOperator *DuckDBToSubstrait::TransformCTE(LogicalMaterializedCTE &dop) {
 	cte_indices.push_back(dop.table_index);
 	auto cte = dop.children[0].get();
 	auto root = dop.children[1].get();
-	plan.add_relations()->set_allocated_rel(TransformOp(*cte));
+	plan->add_relations()->set_allocated_rel(TransformOp(*cte));
 	if (root->type == LogicalOperatorType::LOGICAL_MATERIALIZED_CTE) {
 		return TransformCTE(root->Cast<LogicalMaterializedCTE>());
 	}
@@ -2652,15 +2971,15 @@ void DuckDBToSubstrait::TransformPlan(LogicalOperator &dop) {
 		// https://duckdb.org/2024/09/09/announcing-duckdb-110#automatic-cte-materialization
 		auto &lmc = dop.Cast<LogicalMaterializedCTE>();
 		auto root = TransformCTE(lmc);
-		plan.add_relations()->set_allocated_root(TransformRootOp(*root));
+		plan->add_relations()->set_allocated_root(TransformRootOp(*root));
 	} else {
-		plan.add_relations()->set_allocated_root(TransformRootOp(dop));
+		plan->add_relations()->set_allocated_root(TransformRootOp(dop));
 	}
 	if (strict && !errors.empty()) {
 		throw InvalidInputException("Strict Mode is set to true, and the following warnings/errors happened. \n" +
 		                            errors);
 	}
-	auto version = plan.mutable_version();
+	auto version = plan->mutable_version();
 	version->set_major_number(0);
 	version->set_minor_number(78);
 	version->set_patch_number(0);
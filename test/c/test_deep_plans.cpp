@@ -0,0 +1,156 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "test_substrait_c_utils.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace duckdb;
+using namespace std;
+
+//! Builds a query that adds one to i in each of depth nested subqueries, every level adding a projection and a filter
+static string DeepQuery(idx_t depth) {
+	string query = "SELECT i FROM integers";
+	for (idx_t level = 0; level < depth; level++) {
+		query = "SELECT i + 1 AS i FROM (" + query + ") t" + to_string(level) + " WHERE i > 0";
+	}
+	return query;
+}
+
+TEST_CASE("Test deep plans with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	// Keep the optimizer from collapsing the nested projections
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1), (2), (3)"));
+
+	auto result = ExecuteViaSubstrait(con, DeepQuery(200));
+	REQUIRE(CHECK_COLUMN(result, 0, {201, 202, 203}));
+}
+
+TEST_CASE("Test plan depth limit with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1), (2), (3)"));
+
+	auto proto = GetSubstrait(con, DeepQuery(50));
+	REQUIRE_NO_FAIL(con.Query("SET substrait_max_plan_depth = 50"));
+
+	// Producing the plan fails with an error instead of recursing arbitrarily deep
+	auto result = con.Query("CALL get_substrait('" + DeepQuery(50) + "')");
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "substrait_max_plan_depth"));
+
+	// So does consuming it
+	result = FromSubstrait(con, proto);
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "substrait_max_plan_depth"));
+
+	REQUIRE_NO_FAIL(con.Query("RESET substrait_max_plan_depth"));
+	result = FromSubstrait(con, proto);
+	REQUIRE(CHECK_COLUMN(result, 0, {51, 52, 53}));
+
+	// The limit can only be raised up to a depth whose recursion is known to fit on the stack
+	REQUIRE_NO_FAIL(con.Query("SET max_expression_depth TO 100000"));
+	REQUIRE_NO_FAIL(con.Query("SET substrait_max_plan_depth = 2000"));
+	REQUIRE_FAIL(con.Query("SET substrait_max_plan_depth = 2001"));
+	REQUIRE_FAIL(con.Query("SET GLOBAL substrait_max_plan_depth = 100000"));
+	result = ExecuteViaSubstrait(con, DeepQuery(900));
+	REQUIRE(CHECK_COLUMN(result, 0, {901, 902, 903}));
+}
+
+TEST_CASE("Test wide conjunctions with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	// Keep the filters in a single filter operator instead of having them merged into table filters
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1), (2), (3)"));
+
+	// Emitted as one variadic and/or, a chain of binary calls would exceed the plan recursion limit
+	string and_query = "SELECT i FROM integers WHERE i <> 0";
+	string or_query = "SELECT i FROM integers WHERE i = 0";
+	for (idx_t term = 1; term < 1000; term++) {
+		and_query += " AND i <> -" + to_string(term);
+		or_query += " OR i = " + to_string(term + 1);
+	}
+	auto result = ExecuteViaSubstrait(con, and_query + " ORDER BY i");
+	REQUIRE(CHECK_COLUMN(result, 0, {1, 2, 3}));
+	result = ExecuteViaSubstrait(con, or_query + " ORDER BY i");
+	REQUIRE(CHECK_COLUMN(result, 0, {2, 3}));
+}
+
+TEST_CASE("Benchmark consuming deep plans with Substrait API", "[.][substrait-benchmark]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+	REQUIRE_NO_FAIL(con.Query("SET max_expression_depth TO 100000"));
+	REQUIRE_NO_FAIL(con.Query("SET substrait_max_plan_depth TO 2000"));
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+
+	// Each level adds two Rel nodes, consuming the plan should take time linear in the depth
+	for (idx_t depth = 50; depth <= 400; depth *= 2) {
+		auto proto = GetSubstrait(con, DeepQuery(depth));
+		auto start = std::chrono::steady_clock::now();
+		auto result = FromSubstrait(con, proto);
+		auto end = std::chrono::steady_clock::now();
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::INTEGER(NumericCast<int32_t>(depth + 1))}));
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << "depth " << depth << ": " << elapsed << "us" << std::endl;
+	}
+}
+
+//! The transformers recurse, so this only covers chains up to the depth limit. Chains deeper than the limit (e.g. the
+//! 10k deep plans of machine-generated workloads) are rejected.
+TEST_CASE("Benchmark operator and expression chains up to the depth limit with Substrait API",
+          "[.][substrait-benchmark]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+	REQUIRE_NO_FAIL(con.Query("SET max_expression_depth TO 100000"));
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+
+	// With the default limit, deep chains fail with an error instead of overflowing the stack
+	auto result = con.Query("CALL get_substrait('" + DeepQuery(1000) + "')");
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "substrait_max_plan_depth"));
+
+	// Run up to the highest depth the setting allows, anything deeper is rejected
+	REQUIRE_NO_FAIL(con.Query("SET substrait_max_plan_depth TO 2000"));
+	result = con.Query("CALL get_substrait('" + DeepQuery(1200) + "')");
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "substrait_max_plan_depth"));
+	for (idx_t depth = 240; depth <= 960; depth *= 2) {
+		// Each level of the deep query adds two operators, the expression query nests one addition per level
+		string expression_query = "SELECT i";
+		for (idx_t level = 0; level < depth; level++) {
+			expression_query += " + 1";
+		}
+		expression_query += " AS i FROM integers";
+		auto expected = Value::INTEGER(NumericCast<int32_t>(depth + 1));
+
+		auto start = std::chrono::steady_clock::now();
+		result = ExecuteViaSubstrait(con, DeepQuery(depth));
+		auto end = std::chrono::steady_clock::now();
+		REQUIRE(CHECK_COLUMN(result, 0, {expected}));
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << "operator depth " << 2 * depth << ": " << elapsed << "us" << std::endl;
+
+		start = std::chrono::steady_clock::now();
+		result = ExecuteViaSubstrait(con, expression_query);
+		end = std::chrono::steady_clock::now();
+		REQUIRE(CHECK_COLUMN(result, 0, {expected}));
+		elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << "expression depth " << depth << ": " << elapsed << "us" << std::endl;
+	}
+}
@@ -6,6 +6,7 @@
 #include "test_substrait_c_utils.hpp"
 
 #include <chrono>
+#include <fstream>
 #include <thread>
 #include <iostream>
 
@@ -60,6 +61,35 @@ TEST_CASE("Test C Get and To Json-Substrait API", "[substrait-api]") {
   REQUIRE_THROWS(FromSubstraitJSON(con,"this is not valid"));
 }
 
+TEST_CASE("Test C Substrait plans read from files", "[substrait-api]") {
+  DuckDB db(nullptr);
+  Connection con(db);
+  REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+  REQUIRE_NO_FAIL(
+      con.Query("INSERT INTO integers VALUES (1), (2), (3), (NULL)"));
+
+  auto proto_path = TestCreatePath("plan.pb");
+  auto json_path = TestCreatePath("plan.json");
+  {
+    std::ofstream proto_file(proto_path, std::ios::binary);
+    proto_file << GetSubstrait(con, "select * from integers limit 2");
+    std::ofstream json_file(json_path);
+    json_file << GetSubstraitJSON(con, "select * from integers where i > 1");
+  }
+
+  auto result = con.Query("CALL from_substrait_file('" + proto_path + "')");
+  REQUIRE(CHECK_COLUMN(result, 0, {1, 2}));
+
+  result = con.Query("CALL from_substrait_json_file('" + json_path + "')");
+  REQUIRE(CHECK_COLUMN(result, 0, {2, 3}));
+
+  // the binary and json readers do not accept each other's plans
+  REQUIRE_FAIL(con.Query("CALL from_substrait_file('" + json_path + "')"));
+  REQUIRE_FAIL(con.Query("CALL from_substrait_json_file('" + proto_path + "')"));
+  REQUIRE_FAIL(con.Query("CALL from_substrait_file('" + TestCreatePath("missing.pb") + "')"));
+  REQUIRE_FAIL(con.Query("CALL from_substrait_file(NULL)"));
+}
+
 TEST_CASE("Test C CTAS Select columns with Substrait API", "[substrait-api]") {
 	DuckDB db(nullptr);
 	Connection con(db);
@@ -807,3 +837,127 @@ TEST_CASE("Test cast to deprecated time type", "[substrait-api][deprecated-types
 	auto result = FromSubstrait(con, plan_blob);
 	REQUIRE(CHECK_COLUMN(result, 0, {Value::TIME(10, 30, 0, 0)}));
 }
+
+TEST_CASE("Test concurrent get_substrait calls", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range AS i FROM range(1000)"));
+	// A user setting that must survive the calls
+	REQUIRE_NO_FAIL(con.Query("SET disabled_optimizers = 'top_n'"));
+
+	// A plain query whose plan depends on the optimizers get_substrait leaves out (the IN clause rewrite)
+	string plain_query = "EXPLAIN SELECT i FROM integers WHERE i + 1 IN (";
+	for (idx_t value = 0; value < 100; value++) {
+		plain_query += (value ? ", " : "") + to_string(value * 7);
+	}
+	plain_query += ")";
+	auto plain_plan = con.Query(plain_query);
+	REQUIRE_NO_FAIL(*plain_plan);
+	auto expected_plan = plain_plan->GetValue(1, 0).ToString();
+
+	const idx_t thread_count = 8;
+	const idx_t calls_per_thread = 20;
+	atomic<idx_t> failures(0);
+	atomic<bool> producing(true);
+	vector<std::thread> threads;
+	// Concurrent plain queries keep planning with all of their optimizers
+	std::thread plain_thread([&db, &failures, &producing, &plain_query, &expected_plan]() {
+		Connection plain_con(db);
+		do {
+			auto result = plain_con.Query(plain_query);
+			if (result->HasError() || result->GetValue(1, 0).ToString() != expected_plan) {
+				failures++;
+			}
+		} while (producing);
+	});
+	for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+		threads.emplace_back([&db, &failures, calls_per_thread]() {
+			Connection thread_con(db);
+			for (idx_t call_idx = 0; call_idx < calls_per_thread; call_idx++) {
+				auto result = thread_con.Query("CALL get_substrait('SELECT i FROM integers WHERE i IN (1, 2, 3) "
+				                               "ORDER BY i LIMIT 2')");
+				if (result->HasError()) {
+					failures++;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	producing = false;
+	plain_thread.join();
+	REQUIRE(failures == 0);
+
+	// The user's disabled optimizers are left as they were
+	auto disabled = con.Query("SELECT current_setting('disabled_optimizers')");
+	REQUIRE(CHECK_COLUMN(disabled, 0, {"top_n"}));
+}
+
+//! Requires the query to give the same (ordered) result when executed through a Substrait plan
+static void RequireSameResultViaSubstrait(Connection &con, const string &query,
+                                          const named_parameter_map_t &options = named_parameter_map_t()) {
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+	duckdb::vector<Value> params {Value(query)};
+	auto plan = con.TableFunction("get_substrait", params, options)->Execute();
+	auto proto = plan->FetchRaw()->GetValue(0, 0).GetValueUnsafe<string_t>().GetString();
+	auto result = FromSubstrait(con, proto);
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		duckdb::vector<Value> column;
+		for (idx_t row_idx = 0; row_idx < expected->RowCount(); row_idx++) {
+			column.push_back(expected->GetValue(col_idx, row_idx));
+		}
+		REQUIRE(CHECK_COLUMN(result, col_idx, column));
+	}
+}
+
+TEST_CASE("Test consuming large IN lists as joins", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	// Keep the IN lists as expressions instead of pushing them into the scan
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_optimizer"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE test (a INT, b VARCHAR)"));
+	REQUIRE_NO_FAIL(
+	    con.Query("INSERT INTO test VALUES (1, 'one'), (2, 'two'), (3, 'three'), (100, 'hundred'), (NULL, NULL)"));
+
+	duckdb::vector<string> queries {
+	    "SELECT * FROM test WHERE a IN (1, 7, 10, 50, 100) ORDER BY a",
+	    "SELECT * FROM test WHERE b IN ('one', 'three', 'five') ORDER BY a",
+	    "SELECT a, a IN (1, 2, 3, NULL) FROM test ORDER BY a NULLS LAST",
+	    "SELECT a, a NOT IN (1, 2, 3, NULL) FROM test ORDER BY a NULLS LAST",
+	    "SELECT * FROM test WHERE NOT (a IN (1, 2, 3, NULL)) ORDER BY a",
+	    "SELECT * FROM test WHERE a NOT IN (1, 2, 50) ORDER BY a",
+	    "SELECT * FROM test WHERE a IN (1, 2, a + 1) ORDER BY a"};
+	// The threshold is a setting of the consuming connection, the plans are transformed on a connection of their own
+	for (auto threshold : {"3", "0"}) {
+		REQUIRE_NO_FAIL(con.Query(string("SET substrait_in_list_join_threshold = ") + threshold));
+		for (auto &query : queries) {
+			RequireSameResultViaSubstrait(con, query);
+		}
+	}
+}
+
+TEST_CASE("Test compact IN filters", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE test (a INT, b VARCHAR)"));
+	REQUIRE_NO_FAIL(
+	    con.Query("INSERT INTO test VALUES (1, 'one'), (2, 'two'), (3, 'three'), (100, 'hundred'), (NULL, NULL)"));
+
+	named_parameter_map_t options;
+	options["compact_in_filters"] = Value::BOOLEAN(true);
+	duckdb::vector<string> queries {
+	    "SELECT * FROM test WHERE a IN (1, 7, 10, 50, 100) ORDER BY a",
+	    "SELECT * FROM test WHERE b IN ('one', 'three', 'five') ORDER BY a",
+	    "SELECT * FROM test WHERE a IN (1, 2, NULL) ORDER BY a",
+	    "SELECT * FROM test WHERE a NOT IN (1, 2, 50) ORDER BY a",
+	    "SELECT a, a IN (1, 2, 3) FROM test ORDER BY a NULLS LAST"};
+	// Optimized plans push the lists into the scan as optional filters, unoptimized ones keep them in a filter
+	for (auto enable_optimizer : {true, false}) {
+		options["enable_optimizer"] = Value::BOOLEAN(enable_optimizer);
+		for (auto &query : queries) {
+			RequireSameResultViaSubstrait(con, query, options);
+		}
+	}
+}
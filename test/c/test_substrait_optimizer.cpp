@@ -0,0 +1,27 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "substrait_optimizer.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test the Substrait optimizer passes match DuckDB", "[substrait-api]") {
+	// The pass list is a copy of Optimizer::Optimize, it has to be checked again whenever DuckDB is bumped
+	string source_id = DuckDB::SourceID();
+	REQUIRE(!source_id.empty());
+	REQUIRE(StringUtil::StartsWith(SUBSTRAIT_OPTIMIZER_DUCKDB_SOURCE_ID, source_id));
+
+	// Every optimizer of DuckDB is either run or deliberately left out
+	DuckDB db(nullptr);
+	Connection con(db);
+	auto result = con.Query("SELECT name FROM duckdb_optimizers()");
+	REQUIRE_NO_FAIL(*result);
+	auto known_types = GetSubstraitOptimizerTypes();
+	set<OptimizerType> known(known_types.begin(), known_types.end());
+	for (idx_t row_idx = 0; row_idx < result->RowCount(); row_idx++) {
+		auto name = result->GetValue(0, row_idx).ToString();
+		INFO("optimizer " << name);
+		REQUIRE(known.find(OptimizerTypeFromString(name)) != known.end());
+	}
+	REQUIRE(known.size() == result->RowCount());
+}
@@ -0,0 +1,68 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "test_substrait_c_utils.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace duckdb;
+using namespace std;
+
+//! Produces and consumes the plans of all queries of a TPC suite repeatedly and prints the time spent on each side.
+//! The tables are generated empty, so consuming a plan is dominated by parsing and transforming it.
+//! The gain of allocating plans on protobuf arenas has not been measured yet: run this on the parent of the commit
+//! that introduced the arenas and on a later build, and report both timings.
+static void BenchmarkSuitePlans(const string &suite, const string &generator, idx_t iterations) {
+	DuckDB db(nullptr);
+	Connection con(db);
+	if (con.Query("LOAD " + suite)->HasError()) {
+		std::cout << suite << " is not available, skipping" << std::endl;
+		return;
+	}
+	REQUIRE_NO_FAIL(con.Query("CALL " + generator + "(sf=0)"));
+	auto queries = con.Query("SELECT query FROM " + suite + "_queries() ORDER BY query_nr");
+	REQUIRE_NO_FAIL(*queries);
+
+	vector<string> plans;
+	idx_t skipped = 0;
+	auto produce_elapsed = std::chrono::steady_clock::duration::zero();
+	for (idx_t row = 0; row < queries->RowCount(); row++) {
+		auto query = queries->GetValue(0, row).ToString();
+		auto call = "CALL get_substrait('" + StringUtil::Replace(query, "'", "''") + "')";
+		auto start = std::chrono::steady_clock::now();
+		unique_ptr<MaterializedQueryResult> result;
+		for (idx_t iteration = 0; iteration < iterations; iteration++) {
+			result = con.Query(call);
+		}
+		produce_elapsed += std::chrono::steady_clock::now() - start;
+		if (result->HasError()) {
+			skipped++;
+			continue;
+		}
+		plans.push_back(StringValue::Get(result->GetValue(0, 0)));
+	}
+
+	auto consume_elapsed = std::chrono::steady_clock::duration::zero();
+	for (auto &plan : plans) {
+		auto start = std::chrono::steady_clock::now();
+		for (idx_t iteration = 0; iteration < iterations; iteration++) {
+			REQUIRE_NO_FAIL(*FromSubstrait(con, plan));
+		}
+		consume_elapsed += std::chrono::steady_clock::now() - start;
+	}
+
+	std::cout << suite << ": " << plans.size() << " plans (" << skipped << " queries not supported), " << iterations
+	          << " iterations" << std::endl;
+	std::cout << "  produce: " << std::chrono::duration_cast<std::chrono::milliseconds>(produce_elapsed).count()
+	          << "ms" << std::endl;
+	std::cout << "  consume: " << std::chrono::duration_cast<std::chrono::milliseconds>(consume_elapsed).count()
+	          << "ms" << std::endl;
+}
+
+TEST_CASE("Benchmark producing and consuming TPC-H plans with Substrait API", "[.][substrait-benchmark]") {
+	BenchmarkSuitePlans("tpch", "dbgen", 50);
+}
+
+TEST_CASE("Benchmark producing and consuming TPC-DS plans with Substrait API", "[.][substrait-benchmark]") {
+	BenchmarkSuitePlans("tpcds", "dsdgen", 10);
+}
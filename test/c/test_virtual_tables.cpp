@@ -0,0 +1,142 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "test_substrait_c_utils.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace duckdb;
+using namespace std;
+
+//! Builds a query over an inline table of row_count rows (i, s), where every tenth i is NULL
+static string ValuesQuery(idx_t row_count, const string &select_list) {
+	string values;
+	for (idx_t row = 0; row < row_count; row++) {
+		if (row > 0) {
+			values += ", ";
+		}
+		auto i = row % 10 == 0 ? string("NULL") : to_string(row);
+		values += "(" + i + ", 'v" + to_string(row) + "')";
+	}
+	return "SELECT " + select_list + " FROM (VALUES " + values + ") t(i, s)";
+}
+
+TEST_CASE("Test large virtual tables with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	// Large enough to be decoded into a collection, spanning multiple vectors
+	auto query = ValuesQuery(5000, "count(*), count(i), sum(i), min(s), max(s)");
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+
+	auto result = ExecuteViaSubstrait(con, query);
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		REQUIRE(CHECK_COLUMN(result, col_idx, {expected->GetValue(col_idx, 0)}));
+	}
+
+	result = ExecuteViaSubstraitJSON(con, ValuesQuery(5000, "i, s") + " ORDER BY s LIMIT 3");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value(), 1, Value()}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"v0", "v1", "v10"}));
+}
+
+TEST_CASE("Test large virtual tables of many types with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	// Directly decoded types next to ones decoded through a Value (the decimal and the interval)
+	string values;
+	for (idx_t row = 0; row < 3000; row++) {
+		if (row > 0) {
+			values += ", ";
+		}
+		auto r = to_string(row);
+		if (row % 7 == 0) {
+			values += "(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL)";
+			continue;
+		}
+		values += "(" + to_string(row % 2 == 0) + "::BOOLEAN, " + to_string(row % 100) + "::TINYINT, " + r +
+		          "::BIGINT, " + r + ".5::DOUBLE, 'blob" + r + "'::BLOB, DATE '2024-01-01' + " + r +
+		          "::INTEGER, TIMESTAMP '2024-01-01 10:00:00' + INTERVAL (" + r + ") SECOND, " + r +
+		          ".25::DECIMAL(10, 2), INTERVAL (" + r + ") DAY)";
+	}
+	auto query = "SELECT count(b), sum(t), sum(i), sum(d), max(bl), max(dt), max(ts), sum(dec), max(iv) FROM (VALUES " +
+	             values + ") v(b, t, i, d, bl, dt, ts, dec, iv)";
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+
+	auto result = ExecuteViaSubstrait(con, query);
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		REQUIRE(CHECK_COLUMN(result, col_idx, {expected->GetValue(col_idx, 0)}));
+	}
+}
+
+TEST_CASE("Test spilling large virtual tables with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	auto query = ValuesQuery(5000, "count(*), count(i), sum(i), min(s), max(s)");
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+
+	duckdb::vector<Value> params {Value(query)};
+	named_parameter_map_t named_params {{"values_spill_directory", Value(TestDirectoryPath())}};
+	auto get_result = con.TableFunction("get_substrait", params, named_params)->Execute();
+	auto proto = get_result->FetchRaw()->GetValue(0, 0).GetValueUnsafe<string_t>().GetString();
+	auto inline_proto = GetSubstrait(con, query);
+	// The rows live in a Parquet file, the plan only references it
+	REQUIRE(proto.size() < 2048);
+	REQUIRE(inline_proto.size() > proto.size() * 10);
+
+	auto result = FromSubstrait(con, proto);
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		REQUIRE(CHECK_COLUMN(result, col_idx, {expected->GetValue(col_idx, 0)}));
+	}
+
+	// The same input is written to the same file
+	get_result = con.TableFunction("get_substrait", params, named_params)->Execute();
+	REQUIRE(get_result->FetchRaw()->GetValue(0, 0).GetValueUnsafe<string_t>().GetString() == proto);
+}
+
+TEST_CASE("Test large virtual tables that are not spilled with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	// Parquet does not read these types back exactly, so they stay inlined
+	string values;
+	for (idx_t row = 0; row < 3000; row++) {
+		auto r = to_string(row);
+		values += string(row > 0 ? ", " : "") + "(" + r + "::HUGEINT * 100000000000000000000, INTERVAL (" + r +
+		          ") MICROSECONDS, '10:00:00+0" + to_string(row % 10) + "'::TIMETZ)";
+	}
+	auto query = "SELECT count(*), sum(h), max(iv), max(tz) FROM (VALUES " + values + ") v(h, iv, tz)";
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+
+	duckdb::vector<Value> params {Value(query)};
+	named_parameter_map_t named_params {{"values_spill_directory", Value(TestDirectoryPath())}};
+	auto json = con.TableFunction("get_substrait_json", params, named_params)->Execute()->FetchRaw()->GetValue(0, 0);
+	REQUIRE(json.ToString().find("uriFile") == string::npos);
+
+	auto get_result = con.TableFunction("get_substrait", params, named_params)->Execute();
+	auto proto = get_result->FetchRaw()->GetValue(0, 0).GetValueUnsafe<string_t>().GetString();
+	auto result = FromSubstrait(con, proto);
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		REQUIRE(CHECK_COLUMN(result, col_idx, {expected->GetValue(col_idx, 0)}));
+	}
+}
+
+TEST_CASE("Benchmark consuming large virtual tables with Substrait API", "[.][substrait-benchmark]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	for (idx_t row_count = 12500; row_count <= 100000; row_count *= 2) {
+		auto proto = GetSubstrait(con, ValuesQuery(row_count, "count(*)"));
+		auto start = std::chrono::steady_clock::now();
+		auto result = FromSubstrait(con, proto);
+		auto end = std::chrono::steady_clock::now();
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(NumericCast<int64_t>(row_count))}));
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << "rows " << row_count << ": " << elapsed << "us" << std::endl;
+	}
+}
@@ -0,0 +1,72 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "test_substrait_c_utils.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace duckdb;
+using namespace std;
+
+//! Builds a query with function_count window functions, cycling through spec_count partition/order specs
+static string WindowQuery(idx_t function_count, idx_t spec_count) {
+	string query = "SELECT id";
+	for (idx_t function_idx = 0; function_idx < function_count; function_idx++) {
+		auto spec = function_idx % spec_count;
+		query += ", sum(val + " + to_string(function_idx) + ") OVER (PARTITION BY id % " + to_string(spec + 2) +
+		         " ORDER BY id) AS w" + to_string(function_idx);
+	}
+	return query + " FROM range(100) t(id), (SELECT 1 AS val) v ORDER BY id";
+}
+
+TEST_CASE("Test many window functions over few specs with Substrait API", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	auto query = WindowQuery(200, 4);
+	auto expected = con.Query(query);
+	REQUIRE_NO_FAIL(*expected);
+
+	auto result = ExecuteViaSubstrait(con, query);
+	REQUIRE_NO_FAIL(*result);
+	auto &actual = result->Cast<MaterializedQueryResult>();
+	REQUIRE(actual.RowCount() == expected->RowCount());
+	for (idx_t col_idx = 0; col_idx < expected->ColumnCount(); col_idx++) {
+		for (idx_t row_idx = 0; row_idx < expected->RowCount(); row_idx++) {
+			REQUIRE(actual.GetValue(col_idx, row_idx) == expected->GetValue(col_idx, row_idx));
+		}
+	}
+}
+
+TEST_CASE("Test window functions differing in the placement of NULLs", "[substrait-api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE window_data (id INTEGER, ord_key INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO window_data VALUES (1, NULL), (2, 2), (3, 1), (4, NULL)"));
+
+	auto result = ExecuteViaSubstrait(con, "SELECT id, "
+	                                       "row_number() OVER (ORDER BY ord_key NULLS FIRST, id) AS rn_first, "
+	                                       "row_number() OVER (ORDER BY ord_key NULLS LAST, id) AS rn_last, "
+	                                       "row_number() OVER (ORDER BY ord_key NULLS FIRST, id) AS rn_first_again "
+	                                       "FROM window_data ORDER BY id");
+	REQUIRE(CHECK_COLUMN(result, 0, {1, 2, 3, 4}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1, 4, 3, 2}));
+	REQUIRE(CHECK_COLUMN(result, 2, {3, 2, 1, 4}));
+	REQUIRE(CHECK_COLUMN(result, 3, {1, 4, 3, 2}));
+}
+
+TEST_CASE("Benchmark producing plans with many window functions", "[.][substrait-benchmark]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	// Grouping the window functions by spec should take time linear in their number
+	for (idx_t function_count = 100; function_count <= 800; function_count *= 2) {
+		auto query = WindowQuery(function_count, 5);
+		auto start = std::chrono::steady_clock::now();
+		auto proto = GetSubstrait(con, query);
+		auto end = std::chrono::steady_clock::now();
+		REQUIRE(!proto.empty());
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		std::cout << function_count << " window functions: " << elapsed << "us" << std::endl;
+	}
+}